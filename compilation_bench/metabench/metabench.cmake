@@ -12,9 +12,18 @@ endif()
 
 set(TMDESC_METABENCH_SELF_FILE_DIR ${CMAKE_CURRENT_LIST_DIR} CACHE INTERNAL "")
 
+set(TMDESC_METABENCH_THRESHOLD 20 CACHE STRING
+    "Allowed compile time and peak memory regression against the metabench baseline, percents")
+set(TMDESC_METABENCH_BASELINE_REPETITIONS 7 CACHE STRING
+    "Minimal repetitions count for each item when the metabench baseline is updated")
+
 # Global target for bench all
 add_custom_target(tmdesc_metabench_all)
 
+# Global targets to check all datasets with baseline, and to update the baselines
+add_custom_target(tmdesc_metabench_check)
+add_custom_target(tmdesc_metabench_update_baseline)
+
 
 # Register dataset
 #
@@ -29,6 +38,14 @@ add_custom_target(tmdesc_metabench_all)
 #                     The @item variable in erb template is an input array item.
 # [NAME] - dataset readable name. Default: ${target}
 # [REPETITIONS] - repetitions count for each item. Default: 1
+# [BASELINE] - json file with the stored compile time and peak memory for each item, relative to the current
+#              source dir. Enables targets:
+#                ${target}_check - fails if the compile time or the peak memory exceeds the baseline
+#                                  by more than THRESHOLD percents. Part of the tmdesc_metabench_check target.
+#                ${target}_update_baseline - measures again with at least ${TMDESC_METABENCH_BASELINE_REPETITIONS}
+#                                            repetitions and rewrites the baseline file.
+#                                            Part of the tmdesc_metabench_update_baseline target.
+# [THRESHOLD] - allowed regression in percents. Default: ${TMDESC_METABENCH_THRESHOLD}
 function (tmdesc_metabench_add_dataset target erb_template_src dataset_generator)
     if(NOT RUBY_EXECUTABLE)
         add_library(${target} OBJECT EXCLUDE_FROM_ALL ${erb_template_src}) # for target link livrary
@@ -36,7 +53,7 @@ function (tmdesc_metabench_add_dataset target erb_template_src dataset_generator
     endif()
 
     set(options)
-    set(one_value_args NAME REPETITIONS)
+    set(one_value_args NAME REPETITIONS BASELINE THRESHOLD)
     set(multi_value_args )
     cmake_parse_arguments(ARGS "${options}" "${one_value_args}" "${multi_value_args}" ${ARGN})
 
@@ -46,11 +63,15 @@ function (tmdesc_metabench_add_dataset target erb_template_src dataset_generator
     if (NOT ARGS_REPETITIONS)
         set(ARGS_REPETITIONS 1)
     endif()
+    if (NOT ARGS_THRESHOLD)
+        set(ARGS_THRESHOLD ${TMDESC_METABENCH_THRESHOLD})
+    endif()
 
     file(MAKE_DIRECTORY "${CMAKE_CURRENT_BINARY_DIR}/metabench/")
     file(MAKE_DIRECTORY "${CMAKE_CURRENT_BINARY_DIR}/metabench/${target}/")
 
     set(measure_result_path "${CMAKE_CURRENT_BINARY_DIR}/metabench/${target}/data.json")
+    set(baseline_measure_result_path "${CMAKE_CURRENT_BINARY_DIR}/metabench/${target}/baseline_data.json")
     get_filename_component(erb_template_full_path "${erb_template_src}"
                            REALPATH BASE_DIR "${CMAKE_CURRENT_SOURCE_DIR}")
 
@@ -96,15 +117,16 @@ function (tmdesc_metabench_add_dataset target erb_template_src dataset_generator
         )
 
     # time measure target
-    add_custom_command(OUTPUT "${measure_result_path}" COMMAND ${RUBY_EXECUTABLE}
+    set(measure_command ${RUBY_EXECUTABLE}
         -r json
         -r fileutils
         -r ${ruby_bench_impl_src}
         -e "out = measure('${target}', '${dataset_generator}',  '${erb_template_full_path}', '${measured_cpp_file_path}', ${ARGS_REPETITIONS}, '$<TARGET_OBJECTS:${target}>', '${compilation_command_line_file_path}')"
         -e "out['name'] = '${ARGS_NAME}'"
-        -e "IO.write('${measure_result_path}', JSON.pretty_generate(out))"
+        -e "IO.write('${measure_result_path}', JSON.pretty_generate(out))")
+    add_custom_command(OUTPUT "${measure_result_path}" COMMAND ${measure_command}
         SOURCES ${erb_template_full_path}
-        DEPENDS ${erb_template_full_path} ${target}
+        DEPENDS ${erb_template_full_path} ${ruby_bench_impl_src} ${target}
         WORKING_DIRECTORY ${CMAKE_CURRENT_BINARY_DIR}
         VERBATIM USES_TERMINAL)
 
@@ -113,6 +135,46 @@ function (tmdesc_metabench_add_dataset target erb_template_src dataset_generator
         DEPENDS "${measure_result_path}"
         SOURCES ${erb_template_full_path})
     set_target_properties("_metabench_.${target}" PROPERTIES TMDESC_METABENCH_RESULT "${measure_result_path}")
+
+    if(ARGS_BASELINE)
+        get_filename_component(baseline_full_path "${ARGS_BASELINE}"
+                               ABSOLUTE BASE_DIR "${CMAKE_CURRENT_SOURCE_DIR}")
+        set(compiler "${CMAKE_CXX_COMPILER_ID} ${CMAKE_CXX_COMPILER_VERSION}")
+
+        # always measured again: the measured code depends on the library headers, which are not tracked
+        add_custom_target(${target}_check
+            COMMAND ${measure_command}
+            COMMAND ${RUBY_EXECUTABLE}
+                -r ${ruby_bench_impl_src}
+                -e "exit(check_baseline('${measure_result_path}', '${baseline_full_path}', ${ARGS_THRESHOLD}, '${compiler}'))"
+            DEPENDS ${erb_template_full_path} ${ruby_bench_impl_src}
+            WORKING_DIRECTORY ${CMAKE_CURRENT_BINARY_DIR}
+            VERBATIM USES_TERMINAL)
+        add_dependencies(${target}_check ${target})
+        add_dependencies(tmdesc_metabench_check ${target}_check)
+
+        # the baseline is measured with more repetitions, a single noisy run would make every check meaningless
+        set(baseline_repetitions ${ARGS_REPETITIONS})
+        if(baseline_repetitions LESS TMDESC_METABENCH_BASELINE_REPETITIONS)
+            set(baseline_repetitions ${TMDESC_METABENCH_BASELINE_REPETITIONS})
+        endif()
+        add_custom_target(${target}_update_baseline
+            COMMAND ${RUBY_EXECUTABLE}
+                -r json
+                -r fileutils
+                -r ${ruby_bench_impl_src}
+                -e "out = measure('${target}', '${dataset_generator}',  '${erb_template_full_path}', '${measured_cpp_file_path}', ${baseline_repetitions}, '$<TARGET_OBJECTS:${target}>', '${compilation_command_line_file_path}')"
+                -e "out['name'] = '${ARGS_NAME}'"
+                -e "IO.write('${baseline_measure_result_path}', JSON.pretty_generate(out))"
+            COMMAND ${RUBY_EXECUTABLE}
+                -r ${ruby_bench_impl_src}
+                -e "write_baseline('${baseline_measure_result_path}', '${baseline_full_path}', '${compiler}')"
+            DEPENDS ${erb_template_full_path} ${ruby_bench_impl_src}
+            WORKING_DIRECTORY ${CMAKE_CURRENT_BINARY_DIR}
+            VERBATIM USES_TERMINAL)
+        add_dependencies(${target}_update_baseline ${target})
+        add_dependencies(tmdesc_metabench_update_baseline ${target}_update_baseline)
+    endif()
 endfunction()
 
 # Add compilation time chart as html file in build dirrectory
@@ -7,23 +7,66 @@
 require 'benchmark'
 require 'erb'
 require 'fileutils'
+require 'json'
 require 'open3'
 require 'pathname'
 require 'time'
 
-def build(target, cpp_file, compilation_command, exe_file)
-    # command = [cmake_command, '--build', '.', '--target', target]
-    command = compilation_command
+# Peak RSS of the compiler is the ru_maxrss of terminated children, it is read by getrusage(RUSAGE_CHILDREN).
+# The value is the maximum over all children of the process, so each compilation runs in a forked process.
+def peak_rss_supported?
+    return @peak_rss_supported unless @peak_rss_supported.nil?
+    @peak_rss_supported = begin
+        require 'fiddle'
+        Process.respond_to?(:fork) && !Fiddle::Handle::DEFAULT['getrusage'].nil?
+    rescue LoadError, Fiddle::DLError
+        false
+    end
+end
+
+# @return [peak RSS in KiB, user + system CPU time in seconds] of waited children
+def children_rusage
+    rusage_children = -1
+    getrusage = Fiddle::Function.new(Fiddle::Handle::DEFAULT['getrusage'], [Fiddle::TYPE_INT, Fiddle::TYPE_VOIDP], Fiddle::TYPE_INT)
+    buffer = Fiddle::Pointer.malloc(256)
+    raise "getrusage failed" unless getrusage.call(rusage_children, buffer) == 0
+    # struct rusage { timeval ru_utime; timeval ru_stime; long ru_maxrss; ... }, timeval is { long; long }
+    longs = buffer[0, 5 * Fiddle::SIZEOF_LONG].unpack(Fiddle::SIZEOF_LONG == 8 ? 'q5' : 'l5')
+    cpu_time = longs[0] + longs[2] + (longs[1] + longs[3]) / 1e6
+    max_rss = RUBY_PLATFORM.include?('darwin') ? longs[4] / 1024 : longs[4]
+    [max_rss, cpu_time]
+end
+
+# @return [realtime, peak_rss_kb or nil, cpu_time or nil, stdout, stderr, success]
+def run_compilation(compilation_command)
+    unless peak_rss_supported?
+        stdout, stderr, status = nil
+        realtime = Benchmark.realtime { stdout, stderr, status = Open3.capture3(compilation_command) }
+        return [realtime, nil, nil, stdout, stderr, status.success?]
+    end
 
+    reader, writer = IO.pipe
+    pid = fork do
+        reader.close
+        stdout, stderr, status = nil
+        realtime = Benchmark.realtime { stdout, stderr, status = Open3.capture3(compilation_command) }
+        writer.write(Marshal.dump([realtime, *children_rusage, stdout, stderr, status.success?]))
+        writer.close
+        exit!(0)
+    end
+    writer.close
+    result = Marshal.load(reader.read)
+    reader.close
+    Process.wait(pid)
+    result
+end
+
+# @return [realtime, peak_rss_kb or nil, cpu_time or nil]
+def build(target, cpp_file, compilation_command, exe_file)
     FileUtils.touch(cpp_file, mtime: Time.now)  
     File.delete(exe_file) if File.exist?(exe_file) 
 
-    stdout, stderr, status = nil
-
-    
-    realtime = Benchmark.realtime  {                                                       
-        stdout, stderr, status = Open3.capture3(compilation_command)                         
-    } 
+    realtime, peak_rss, cpu_time, stdout, stderr, success = run_compilation(compilation_command)
     # for i in 0..10
     #     stdout, stderr, status = Open3.capture3(*command) 
     #     break if status.success?
@@ -33,13 +76,13 @@ def build(target, cpp_file, compilation_command, exe_file)
     #     sleep(0.1)
     # end
     
-    raise "\nError while c++ file compilation\n\nstdout:\n#{stdout}\n\nstderr:\n#{stderr}\n\nCOmpilation command:\n#{compilation_command}" unless status.success?
+    raise "\nError while c++ file compilation\n\nstdout:\n#{stdout}\n\nstderr:\n#{stderr}\n\nCOmpilation command:\n#{compilation_command}" unless success
 
     #match = stdout.match(/\[metabench compilation time: (.+)\]/i)
     # raise "\nCould not find [metabench compilation time: ...] in the output. Are you using a Ninja or Make generator?\n\nFull stdout:\n" + stdout  if match.nil?
     #realtime = match.captures[0].to_f
 
-    return realtime
+    return [realtime, peak_rss, cpu_time]
 end
 
 class TemplateArgs
@@ -89,16 +132,20 @@ def measure(target, range_expr_str, erb_template, cpp_file,  repetitions, exe_fi
             code = apply_template(erb_template, n)
             measure_code_compilation_time[code] if index == 0 # generate cache on first iteration
 
-            base_times = measure_code_compilation_time[code]
+            base = measure_code_compilation_time[code]
 
 
-            total_times = measure_code_compilation_time["#define METABENCH\n#{code}"]
+            total = measure_code_compilation_time["#define METABENCH\n#{code}"]
 
             out['data'] << {
                 'input' => n,
                 'index' => index,
-                'base_times' => base_times,
-                'total_times' => total_times
+                'base_times' => base.map { |m| m[0] },
+                'total_times' => total.map { |m| m[0] },
+                'base_memory' => base.map { |m| m[1] },
+                'total_memory' => total.map { |m| m[1] },
+                'base_cpu_times' => base.map { |m| m[2] },
+                'total_cpu_times' => total.map { |m| m[2] }
             }
             $stderr.write("\r### tmdesc metabench #{target}..... #{index + 1}/#{range.size}")
         end
@@ -110,3 +157,80 @@ def measure(target, range_expr_str, erb_template, cpp_file,  repetitions, exe_fi
         raise e    
     end
 end
+
+def measured?(values)
+    !values.nil? && !values.include?(nil)
+end
+
+# Cost of the measured code for each input: the difference between the compilation with and without METABENCH.
+# The time is the compiler CPU time if it is available, it does not depend on the machine load as the wall time.
+# The minimum of repetitions is used, it is the least noisy estimate. The difference of two minimums may be
+# slightly negative for the cheap inputs, it is clamped to zero: the measured code can't make the compilation faster.
+# @return [{'input' => n, 'time' => seconds, 'memory' => KiB or nil}, ...] sorted by input
+def summarize(measure_result)
+    measure_result['data'].map { |item|
+        time = item['total_times'].min - item['base_times'].min
+        time = item['total_cpu_times'].min - item['base_cpu_times'].min if measured?(item['total_cpu_times'])
+        memory = measured?(item['total_memory']) ? item['total_memory'].min - item['base_memory'].min : nil
+        {
+            'input' => item['input'],
+            'time' => [time, 0.0].max.round(4),
+            'memory' => memory
+        }
+    }.sort_by { |item| item['input'] }
+end
+
+# Stores the summary of the measure result as the baseline file, which is kept in the repository
+def write_baseline(measure_result_path, baseline_path, compiler)
+    measure_result = JSON.parse(IO.read(measure_result_path))
+    baseline = {
+        'target' => measure_result['target'],
+        'name' => measure_result['name'],
+        'compiler' => compiler,
+        'data' => summarize(measure_result)
+    }
+    FileUtils.mkdir_p(File.dirname(baseline_path))
+    IO.write(baseline_path, JSON.pretty_generate(baseline) + "\n")
+    $stdout.puts("### tmdesc metabench baseline updated: #{baseline_path}")
+end
+
+# A value is regressed when it exceeds the baseline by more than `threshold_percent` percent
+# and by more than `noise_floor`, so that the small inputs do not fail on the measurement noise.
+def regressed?(current, baseline, threshold_percent, noise_floor)
+    return false if current.nil? || baseline.nil?
+    current > baseline * (1.0 + threshold_percent / 100.0) && current - baseline > noise_floor
+end
+
+# Compares the measure result with the baseline
+# @return true if there is no regression
+def check_baseline(measure_result_path, baseline_path, threshold_percent, compiler)
+    measure_result = JSON.parse(IO.read(measure_result_path))
+    target = measure_result['target']
+    unless File.exist?(baseline_path)
+        $stderr.puts("### tmdesc metabench #{target}: no baseline #{baseline_path}, build the '#{target}_update_baseline' target")
+        return false
+    end
+    baseline = JSON.parse(IO.read(baseline_path))
+    if baseline['compiler'] != compiler
+        $stderr.puts("### tmdesc metabench #{target}: WARNING the baseline is measured with '#{baseline['compiler']}', the current compiler is '#{compiler}'")
+    end
+
+    baseline_by_input = baseline['data'].map { |item| [item['input'], item] }.to_h
+    time_noise_floor = 0.1 # s
+    memory_noise_floor = 2048 # KiB
+    success = true
+    $stdout.puts("### tmdesc metabench #{target}: threshold #{threshold_percent}%")
+    $stdout.puts(format("%10s %12s %12s %14s %14s", 'input', 'time, s', 'baseline', 'memory, KiB', 'baseline'))
+    summarize(measure_result).each do |current|
+        base = baseline_by_input[current['input']]
+        next if base.nil?
+        time_regressed = regressed?(current['time'], base['time'], threshold_percent, time_noise_floor)
+        memory_regressed = regressed?(current['memory'], base['memory'], threshold_percent, memory_noise_floor)
+        $stdout.puts(format("%10s %12.3f %12.3f %14s %14s%s", current['input'], current['time'], base['time'],
+                            current['memory'].to_s, base['memory'].to_s,
+                            time_regressed || memory_regressed ? '  REGRESSION' : ''))
+        success &&= !(time_regressed || memory_regressed)
+    end
+    $stderr.puts("### tmdesc metabench #{target}: compilation regressed beyond #{threshold_percent}%") unless success
+    success
+end
@@ -0,0 +1,112 @@
+// Copyright Victor Smirnov 2021-2022
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+//
+// The documentation can be found at the library's page:
+// https://github.com/Ariox41/tmdesc
+
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/// Minimal runtime benchmark harness: batches of calls are timed until the batch takes `min_time`,
+/// the result is the median of `repetitions` batches.
+namespace runtime_bench {
+
+/// Prevents the compiler from optimizing out the value calculation.
+template <class T> inline void do_not_optimize(const T& value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+/// Prevents the compiler from assuming that memory is unchanged between iterations.
+inline void clobber_memory() noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : : "memory");
+#endif
+}
+
+struct result {
+    std::string group;     ///< benchmarked operation, e.g. "visit/sum"
+    std::string name;      ///< implementation, e.g. "tmdesc" or "handwritten"
+    std::size_t width;     ///< members count of the benchmarked type
+    std::size_t bytes;     ///< bytes of objects processed by a single call
+    std::size_t objects;   ///< objects processed by a single call
+    double ns_per_object;  ///< median time per object
+    double bytes_per_second;
+};
+
+class runner {
+public:
+    using clock = std::chrono::steady_clock;
+
+    std::chrono::nanoseconds min_time = std::chrono::milliseconds(20);
+    int repetitions                    = 5;
+
+    /// Measures `fn()`, which processes `objects` objects of `bytes` total size per call.
+    template <class Fn>
+    const result& run(std::string group, std::string name, std::size_t width, std::size_t objects,
+                      std::size_t bytes, Fn&& fn) {
+        return run_timed(std::move(group), std::move(name), width, objects, bytes,
+                         [this, &fn](std::size_t iterations) { return time_batch(fn, iterations); });
+    }
+
+    /// Measures the batches timed by `timed_batch(iterations)`, which returns the duration of `iterations` calls.
+    /// @details For the calls with a setup which must not be timed, like starting the threads.
+    template <class TimedBatch>
+    const result& run_timed(std::string group, std::string name, std::size_t width, std::size_t objects,
+                            std::size_t bytes, TimedBatch&& timed_batch) {
+        std::size_t iterations = 1;
+        for (;;) {
+            if (timed_batch(iterations) >= min_time || iterations >= (std::size_t(1) << 30))
+                break;
+            iterations *= 2;
+        }
+        std::vector<double> samples;
+        for (int r = 0; r < repetitions; ++r)
+            samples.push_back(double(std::chrono::nanoseconds(timed_batch(iterations)).count()) / double(iterations));
+        std::nth_element(samples.begin(), samples.begin() + samples.size() / 2, samples.end());
+        const double ns_per_call = samples[samples.size() / 2];
+
+        results_.push_back({std::move(group), std::move(name), width, bytes, objects, ns_per_call / double(objects),
+                            double(bytes) * 1e9 / ns_per_call});
+        return results_.back();
+    }
+
+    const std::vector<result>& results() const noexcept { return results_; }
+
+    /// Writes results as `{"benchmarks": [{...}, ...]}`
+    void write_json(std::ostream& out) const {
+        out << "{\n  \"benchmarks\": [";
+        for (std::size_t i = 0; i < results_.size(); ++i) {
+            const result& r = results_[i];
+            out << (i == 0 ? "\n" : ",\n") << "    {\"group\": \"" << r.group << "\", \"name\": \"" << r.name
+                << "\", \"width\": " << r.width << ", \"objects\": " << r.objects << ", \"bytes\": " << r.bytes
+                << ", \"ns_per_object\": " << r.ns_per_object << ", \"bytes_per_second\": " << r.bytes_per_second
+                << "}";
+        }
+        out << "\n  ]\n}\n";
+    }
+
+private:
+    template <class Fn> std::chrono::nanoseconds time_batch(Fn& fn, std::size_t iterations) {
+        const auto start = clock::now();
+        for (std::size_t i = 0; i < iterations; ++i) {
+            fn();
+            clobber_memory();
+        }
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start);
+    }
+
+    std::vector<result> results_;
+};
+
+} // namespace runtime_bench
@@ -0,0 +1,378 @@
+// Copyright Victor Smirnov 2021-2022
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+//
+// The documentation can be found at the library's page:
+// https://github.com/Ariox41/tmdesc
+
+// Runtime cost of the library operations against hand-written equivalents.
+// usage: runtime_bench [--quick] [--json <file>]
+
+#include "bench.hpp"
+#include "types.hpp"
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <tmdesc/algorithm/for_each.hpp>
+#include <tmdesc/hot_cold.hpp>
+#include <tmdesc/member_path.hpp>
+#include <tmdesc/member_table.hpp>
+#include <tmdesc/members_view.hpp>
+#include <tmdesc/object_graph.hpp>
+#include <tmdesc/random_fill.hpp>
+#include <tmdesc/seqlock.hpp>
+#include <tmdesc/size_history.hpp>
+#include <tmdesc/visit_member.hpp>
+#include <vector>
+
+namespace runtime_bench {
+namespace {
+constexpr std::size_t objects_count = 256;
+
+struct fill {
+    int value;
+    template <class M> void operator()(M member) { member.get() = value++; }
+};
+struct add {
+    int& sum;
+    template <class M> void operator()(M member) const noexcept { sum += member.get(); }
+};
+struct append_text {
+    std::string& out;
+    template <class M> void operator()(M member) const {
+        out.append(member.name().data(), member.name().size());
+        out += '=';
+        out += std::to_string(member.get());
+        out += ';';
+    }
+};
+struct add_value {
+    int& sum;
+    void operator()(int value) const noexcept { sum += value; }
+};
+
+template <class T> std::vector<T> make_objects() {
+    std::vector<T> objects(objects_count);
+    for (std::size_t i = 0; i < objects.size(); ++i)
+        tmdesc::for_each(tmdesc::members_view(objects[i]), fill{int(i)});
+    return objects;
+}
+
+/// all member names of `T` in the rotated order, so that lookups do not hit the same name
+template <class T> std::vector<std::string> lookup_names() {
+    const tmdesc::member_table& table = tmdesc::member_table_of<T>();
+    std::vector<std::string> names;
+    for (std::size_t i = 0; i < objects_count; ++i)
+        names.push_back(table[(i * 7) % table.size()].name.c_str());
+    return names;
+}
+
+template <class T> void bench_type(runner& r) {
+    const std::vector<T> objects      = make_objects<T>();
+    const std::vector<std::string> names = lookup_names<T>();
+    const tmdesc::member_table& table = tmdesc::member_table_of<T>();
+    const std::size_t width           = table.size();
+    const std::size_t bytes           = objects.size() * sizeof(T);
+
+    r.run("visit/sum", "tmdesc::for_each(members_view)", width, objects.size(), bytes, [&] {
+        int sum = 0;
+        for (const T& o : objects)
+            tmdesc::for_each(tmdesc::members_view(o), add{sum});
+        do_not_optimize(sum);
+    });
+    r.run("visit/sum", "handwritten", width, objects.size(), bytes, [&] {
+        int sum = 0;
+        for (const T& o : objects)
+            sum += handwritten_sum(o);
+        do_not_optimize(sum);
+    });
+
+    r.run("member_table/sum", "tmdesc::member_table_of", width, objects.size(), bytes, [&] {
+        int sum = 0;
+        for (const T& o : objects) {
+            for (const tmdesc::member_descriptor& d : table) {
+                if (d.kind == tmdesc::member_kind::signed_integer && d.size == sizeof(int))
+                    sum += *static_cast<const int*>(d.address(&o));
+            }
+        }
+        do_not_optimize(sum);
+    });
+    r.run("member_table/sum", "handwritten", width, objects.size(), bytes, [&] {
+        int sum = 0;
+        for (const T& o : objects)
+            sum += handwritten_sum(o);
+        do_not_optimize(sum);
+    });
+
+    r.run("lookup/visit_by_name", "tmdesc::visit_member_by_name", width, objects.size(), bytes, [&] {
+        int sum = 0;
+        for (std::size_t i = 0; i < objects.size(); ++i)
+            tmdesc::visit_member_by_name(objects[i], names[i], add_value{sum});
+        do_not_optimize(sum);
+    });
+    r.run("lookup/visit_by_name", "counting_instrumentation", width, objects.size(), bytes, [&] {
+        int sum = 0;
+        for (std::size_t i = 0; i < objects.size(); ++i)
+            tmdesc::instrumented_visit_member_by_name<tmdesc::counting_instrumentation>(objects[i], names[i],
+                                                                                        add_value{sum});
+        do_not_optimize(sum);
+    });
+    r.run("lookup/visit_by_name", "handwritten if-chain", width, objects.size(), bytes, [&] {
+        int sum = 0;
+        for (std::size_t i = 0; i < objects.size(); ++i) {
+            if (const int* m = handwritten_find(objects[i], names[i]))
+                sum += *m;
+        }
+        do_not_optimize(sum);
+    });
+
+    r.run("encode/text", "growing buffer", width, objects.size(), bytes, [&] {
+        std::size_t size = 0;
+        for (const T& o : objects) {
+            std::string out;
+            tmdesc::for_each(tmdesc::members_view(o), append_text{out});
+            size += out.size();
+        }
+        do_not_optimize(size);
+    });
+    r.run("encode/text", "tmdesc::reserve_expected", width, objects.size(), bytes, [&] {
+        std::size_t size = 0;
+        for (const T& o : objects) {
+            std::string out;
+            tmdesc::reserve_expected<T>(out);
+            tmdesc::for_each(tmdesc::members_view(o), append_text{out});
+            tmdesc::size_history<T>::record(out.size());
+            size += out.size();
+        }
+        do_not_optimize(size);
+    });
+
+    std::vector<T> filled(objects.size());
+    std::mt19937_64 rng(1);
+    r.run("generate", "tmdesc::random_fill", width, filled.size(), bytes, [&] {
+        for (T& o : filled)
+            tmdesc::random_fill(o, rng);
+        do_not_optimize(filled.data());
+    });
+
+    r.run("lookup/table_find", "tmdesc::member_table::find", width, objects.size(), bytes, [&] {
+        std::size_t found = 0;
+        for (const std::string& name : names)
+            found += table.find(name) != nullptr;
+        do_not_optimize(found);
+    });
+    r.run("lookup/table_find", "linear search", width, objects.size(), bytes, [&] {
+        std::size_t found = 0;
+        for (const std::string& name : names) {
+            for (const tmdesc::member_descriptor& d : table) {
+                if (d.name == tmdesc::string_view(name)) {
+                    ++found;
+                    break;
+                }
+            }
+        }
+        do_not_optimize(found);
+    });
+}
+
+void bench_path(runner& r) {
+    std::vector<nested> objects(objects_count);
+    for (std::size_t i = 0; i < objects.size(); ++i)
+        objects[i].c.m333 = int(i);
+    const std::size_t bytes = objects.size() * sizeof(nested);
+
+    const auto leaf = tmdesc::path<nested>("c.m333");
+    r.run("path/get_if", "tmdesc::path", 3, objects.size(), bytes, [&] {
+        int sum = 0;
+        for (nested& o : objects)
+            sum += *leaf.get_if<int>(o);
+        do_not_optimize(sum);
+    });
+    r.run("path/get_if", "handwritten", 3, objects.size(), bytes, [&] {
+        int sum = 0;
+        for (nested& o : objects)
+            sum += o.c.m333;
+        do_not_optimize(sum);
+    });
+
+    r.run("path/resolve", "tmdesc::path", 3, 1, 0, [&] {
+        auto p = tmdesc::path<nested>("c.m333");
+        do_not_optimize(p);
+    });
+}
+
+void bench_hot_scan(runner& r) {
+    constexpr std::size_t count = 4096;
+    std::vector<split48> objects(count);
+    tmdesc::split_vector<split48> split;
+    for (std::size_t i = 0; i < count; ++i) {
+        tmdesc::for_each(tmdesc::members_view(objects[i]), fill{int(i)});
+        split.push_back(objects[i]);
+    }
+    const std::size_t width = tmdesc::detail::members_count_v<split48>;
+
+    r.run("hot_scan", "std::vector<T>", width, count, count * sizeof(split48), [&] {
+        int sum = 0;
+        for (const split48& o : objects)
+            sum += handwritten_hot_sum(o);
+        do_not_optimize(sum);
+    });
+    r.run("hot_scan", "tmdesc::split_vector", width, count, count * sizeof(tmdesc::hot_part<split48>), [&] {
+        int sum = 0;
+        for (const auto& hot : split.hot_parts())
+            tmdesc::for_each(tmdesc::members_view(hot), add{sum});
+        do_not_optimize(sum);
+    });
+}
+
+/// decodes each message into a new object, like the message handler of the feed
+template <class Quote> void bench_decode_quote(runner& r, const char* name) {
+    std::vector<std::string> messages(objects_count);
+    for (std::size_t i = 0; i < messages.size(); ++i) {
+        Quote q{};
+        q.symbol    = "XNAS:OPT:AAPL:2026:C:" + std::to_string(100 + i % 900);
+        q.timestamp = std::int64_t(i);
+        for (std::size_t level = 0; level < 4 + i % 5; ++level)
+            q.levels.push_back(std::int32_t(i + level));
+        tmdesc::encode_graph(q, messages[i]);
+    }
+    std::size_t bytes = 0;
+    for (const std::string& m : messages)
+        bytes += m.size();
+
+    r.run("decode/quote", name, tmdesc::detail::members_count_v<Quote>, messages.size(), bytes, [&] {
+        std::int64_t sum = 0;
+        for (const std::string& m : messages) {
+            Quote q;
+            tmdesc::decode_graph(m, q);
+            sum += q.timestamp + q.levels.back() + std::int64_t(q.symbol.size());
+        }
+        do_not_optimize(sum);
+    });
+}
+
+/// `readers` threads take `reads` copies each while a writer thread updates the value every 10 microseconds,
+/// like a market data feed. The result is the wall time per copy of all readers, so it is the inverse of the read
+/// throughput.
+template <class Cache, class Load, class Store>
+void bench_concurrent_reads(runner& r, const char* name, std::size_t readers, Load load, Store store) {
+    constexpr std::size_t reads = 4096;
+    Cache cache;
+    // the threads are started before the timer and released together, only the read loops are timed
+    r.run_timed(
+        "seqlock/read", std::string(name) + " x" + std::to_string(readers) + " readers",
+        tmdesc::detail::members_count_v<wide16>, readers * reads, readers * reads * sizeof(wide16),
+        [&](std::size_t iterations) {
+            std::atomic<bool> done{false};
+            std::atomic<bool> start{false};
+            std::atomic<std::size_t> ready{0};
+            std::atomic<std::size_t> finished{0};
+            std::thread writer([&] {
+                wide16 value{};
+                while (!done.load(std::memory_order_relaxed)) {
+                    ++value.m00;
+                    store(cache, value);
+                    std::this_thread::sleep_for(std::chrono::microseconds(10));
+                }
+            });
+            std::vector<std::thread> threads;
+            for (std::size_t t = 0; t < readers; ++t) {
+                threads.emplace_back([&] {
+                    ready.fetch_add(1, std::memory_order_release);
+                    while (!start.load(std::memory_order_acquire))
+                        std::this_thread::yield();
+                    int sum = 0;
+                    for (std::size_t i = 0; i < iterations * reads; ++i)
+                        sum += load(cache).m00;
+                    do_not_optimize(sum);
+                    finished.fetch_add(1, std::memory_order_release);
+                });
+            }
+            while (ready.load(std::memory_order_acquire) != readers)
+                std::this_thread::yield();
+            const auto begin = runner::clock::now();
+            start.store(true, std::memory_order_release);
+            while (finished.load(std::memory_order_acquire) != readers)
+                std::this_thread::yield();
+            const auto end = runner::clock::now();
+
+            done = true;
+            for (std::thread& t : threads)
+                t.join();
+            writer.join();
+            return end - begin;
+        });
+}
+
+struct locked_wide16 {
+    std::mutex mutex;
+    wide16 value{};
+};
+
+void bench_seqlock(runner& r) {
+    for (std::size_t readers : {1, 4, 16}) {
+        bench_concurrent_reads<tmdesc::seqlock<wide16>>(
+            r, "tmdesc::seqlock", readers, [](const tmdesc::seqlock<wide16>& c) { return c.load(); },
+            [](tmdesc::seqlock<wide16>& c, const wide16& v) { c.store(v); });
+        bench_concurrent_reads<locked_wide16>(
+            r, "std::mutex", readers,
+            [](locked_wide16& c) {
+                std::lock_guard<std::mutex> lock(c.mutex);
+                return c.value;
+            },
+            [](locked_wide16& c, const wide16& v) {
+                std::lock_guard<std::mutex> lock(c.mutex);
+                c.value = v;
+            });
+    }
+}
+
+void print_table(const runner& r) {
+    std::printf("%-22s %-32s %6s %14s %14s\n", "group", "name", "width", "ns/object", "MB/s");
+    for (const result& x : r.results())
+        std::printf("%-22s %-32s %6zu %14.2f %14.1f\n", x.group.c_str(), x.name.c_str(), x.width, x.ns_per_object,
+                    x.bytes_per_second / 1e6);
+}
+} // namespace
+} // namespace runtime_bench
+
+int main(int argc, char** argv) {
+    using namespace runtime_bench;
+    runner r;
+    const char* json_path = nullptr;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--quick") == 0) {
+            r.min_time    = std::chrono::milliseconds(1);
+            r.repetitions = 1;
+        } else if (std::strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+            json_path = argv[++i];
+        } else {
+            std::cerr << "usage: " << argv[0] << " [--quick] [--json <file>]\n";
+            return 2;
+        }
+    }
+
+    bench_type<wide4>(r);
+    bench_type<wide16>(r);
+    bench_type<wide64>(r);
+    bench_path(r);
+    bench_hot_scan(r);
+    bench_decode_quote<heap_quote>(r, "std::string, std::vector");
+    bench_decode_quote<inline_quote>(r, "inline_string, small_vector");
+    bench_seqlock(r);
+
+    print_table(r);
+    if (json_path != nullptr) {
+        std::ofstream out(json_path);
+        r.write_json(out);
+        if (!out)
+            return 1;
+    }
+    return 0;
+}
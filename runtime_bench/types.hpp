@@ -0,0 +1,113 @@
+// Copyright Victor Smirnov 2021-2022
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+//
+// The documentation can be found at the library's page:
+// https://github.com/Ariox41/tmdesc
+
+#pragma once
+#include <cstdint>
+#include <string>
+#include <tmdesc/inline_string.hpp>
+#include <tmdesc/small_vector.hpp>
+#include <tmdesc/string_view.hpp>
+#include <tmdesc/type_info/get_type_info.hpp>
+#include <vector>
+
+/// Synthetic described types of 4, 16 and 64 `int` members with hand-written equivalents of the benchmarked
+/// operations. Member names are base-4 numbers: `m0..m3`, `m00..m33`, `m000..m333`.
+namespace runtime_bench {
+
+#define RUNTIME_BENCH_NONE()
+#define RUNTIME_BENCH_COMMA() ,
+#define RUNTIME_BENCH_PLUS() +
+
+#define RUNTIME_BENCH_SEQ4(X, S, P) X(P##0) S() X(P##1) S() X(P##2) S() X(P##3)
+#define RUNTIME_BENCH_SEQ16(X, S, P)                                                                                   \
+    RUNTIME_BENCH_SEQ4(X, S, P##0)                                                                                     \
+    S() RUNTIME_BENCH_SEQ4(X, S, P##1) S() RUNTIME_BENCH_SEQ4(X, S, P##2) S() RUNTIME_BENCH_SEQ4(X, S, P##3)
+#define RUNTIME_BENCH_SEQ64(X, S, P)                                                                                   \
+    RUNTIME_BENCH_SEQ16(X, S, P##0)                                                                                    \
+    S() RUNTIME_BENCH_SEQ16(X, S, P##1) S() RUNTIME_BENCH_SEQ16(X, S, P##2) S() RUNTIME_BENCH_SEQ16(X, S, P##3)
+
+#define RUNTIME_BENCH_DECLARE(I) int m##I;
+#define RUNTIME_BENCH_DESCRIBE(I) b.member("m" #I, &self::m##I)
+#define RUNTIME_BENCH_SUM(I) o.m##I
+#define RUNTIME_BENCH_FIND(I)                                                                                          \
+    if (name == "m" #I)                                                                                                \
+        return &o.m##I;
+
+#define RUNTIME_BENCH_DEFINE_TYPE(TYPE, SEQ)                                                                           \
+    struct TYPE {                                                                                                      \
+        using self = TYPE;                                                                                             \
+        SEQ(RUNTIME_BENCH_DECLARE, RUNTIME_BENCH_NONE, )                                                               \
+                                                                                                                       \
+        template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<TYPE, Impl> b) {                  \
+            return b.type(b.members(SEQ(RUNTIME_BENCH_DESCRIBE, RUNTIME_BENCH_COMMA, )));                              \
+        }                                                                                                              \
+    };                                                                                                                 \
+    inline int handwritten_sum(const TYPE& o) noexcept { return SEQ(RUNTIME_BENCH_SUM, RUNTIME_BENCH_PLUS, ); }        \
+    inline const int* handwritten_find(const TYPE& o, tmdesc::string_view name) noexcept {                             \
+        SEQ(RUNTIME_BENCH_FIND, RUNTIME_BENCH_NONE, )                                                                  \
+        return nullptr;                                                                                                \
+    }
+
+RUNTIME_BENCH_DEFINE_TYPE(wide4, RUNTIME_BENCH_SEQ4)
+RUNTIME_BENCH_DEFINE_TYPE(wide16, RUNTIME_BENCH_SEQ16)
+RUNTIME_BENCH_DEFINE_TYPE(wide64, RUNTIME_BENCH_SEQ64)
+
+/// Nested described type for the dotted path access
+struct nested {
+    wide4 a;
+    wide16 b;
+    wide64 c;
+
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<nested, Impl> b) {
+        return b.type(b.members(b.member("a", &nested::a), b.member("b", &nested::b), b.member("c", &nested::c)));
+    }
+};
+
+#define RUNTIME_BENCH_DECLARE_HOT(I) int h##I;
+#define RUNTIME_BENCH_DESCRIBE_HOT(I) b.member("h" #I, &self::h##I, b.attributes(b.hot()))
+#define RUNTIME_BENCH_SUM_HOT(I) o.h##I
+
+/// Order-like type with 8 hot members `h00..h13` and 40 cold members `m000..m133`, `m200..m213`
+struct split48 {
+    using self = split48;
+    RUNTIME_BENCH_SEQ4(RUNTIME_BENCH_DECLARE_HOT, RUNTIME_BENCH_NONE, 0)
+    RUNTIME_BENCH_SEQ4(RUNTIME_BENCH_DECLARE_HOT, RUNTIME_BENCH_NONE, 1)
+    RUNTIME_BENCH_SEQ16(RUNTIME_BENCH_DECLARE, RUNTIME_BENCH_NONE, 0)
+    RUNTIME_BENCH_SEQ16(RUNTIME_BENCH_DECLARE, RUNTIME_BENCH_NONE, 1)
+    RUNTIME_BENCH_SEQ4(RUNTIME_BENCH_DECLARE, RUNTIME_BENCH_NONE, 20)
+    RUNTIME_BENCH_SEQ4(RUNTIME_BENCH_DECLARE, RUNTIME_BENCH_NONE, 21)
+
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<split48, Impl> b) {
+        return b.type(b.members(RUNTIME_BENCH_SEQ4(RUNTIME_BENCH_DESCRIBE_HOT, RUNTIME_BENCH_COMMA, 0),
+                                RUNTIME_BENCH_SEQ4(RUNTIME_BENCH_DESCRIBE_HOT, RUNTIME_BENCH_COMMA, 1),
+                                RUNTIME_BENCH_SEQ16(RUNTIME_BENCH_DESCRIBE, RUNTIME_BENCH_COMMA, 0),
+                                RUNTIME_BENCH_SEQ16(RUNTIME_BENCH_DESCRIBE, RUNTIME_BENCH_COMMA, 1),
+                                RUNTIME_BENCH_SEQ4(RUNTIME_BENCH_DESCRIBE, RUNTIME_BENCH_COMMA, 20),
+                                RUNTIME_BENCH_SEQ4(RUNTIME_BENCH_DESCRIBE, RUNTIME_BENCH_COMMA, 21)));
+    }
+};
+inline int handwritten_hot_sum(const split48& o) noexcept {
+    return RUNTIME_BENCH_SEQ4(RUNTIME_BENCH_SUM_HOT, RUNTIME_BENCH_PLUS, 0) +
+           RUNTIME_BENCH_SEQ4(RUNTIME_BENCH_SUM_HOT, RUNTIME_BENCH_PLUS, 1);
+}
+
+/// Market data message with heap-allocated members and with inline members of the same sizes
+template <class String, class Levels> struct basic_quote {
+    String symbol;
+    Levels levels;
+    std::int64_t timestamp;
+
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<basic_quote, Impl> b) {
+        return b.type(b.members(b.member("symbol", &basic_quote::symbol, b.attributes(b.max_size(31))),
+                                b.member("levels", &basic_quote::levels, b.attributes(b.max_size(8))),
+                                b.member("timestamp", &basic_quote::timestamp)));
+    }
+};
+using heap_quote   = basic_quote<std::string, std::vector<std::int32_t>>;
+using inline_quote = basic_quote<tmdesc::inline_string<31>, tmdesc::small_vector<std::int32_t, 8>>;
+
+} // namespace runtime_bench
@@ -22,7 +22,7 @@ namespace tmdesc {
 /// @note The invocation order is defined from left to right.
 #ifdef TMDESC_DOXYGEN
 constexpr auto for_each = [](auto&& v, auto&& fn) -> void {
-    unpack(t, [](auto&& a1, ..., auto&& an) {
+    unpack(v, [](auto&& a1, ..., auto&& an) {
         invoke(fn, a1);
         /*...*/
         invoke(fn, an);
@@ -30,7 +30,7 @@ constexpr auto for_each = [](auto&& v, auto&& fn) -> void {
 };
 #else
 namespace detail {
-template <typename F> struct on_each_arg {
+template <typename Fn> struct on_each_arg {
     Fn fn_;
     template <typename... Args> constexpr void operator()(Args&&... args) const {
         bool unused[] = {true, ((void)::tmdesc::invoke(fn_, static_cast<Args&&>(args)), void(), true)...};
@@ -41,10 +41,10 @@ template <typename F> struct on_each_arg {
 
 template <class T, class = void> struct for_each_impl : core::default_implementation {
     template <class V, class Fn>
-    static constexpr void apply(V&& v, Fn&& fn) noexcept( //
+    static constexpr auto apply(V&& v, Fn&& fn) noexcept( //
         noexcept(unpack(std::declval<V&&>(), std::declval<detail::on_each_arg<Fn&>>())))
-        ->decltype(unpack(std::declval<V&&>(), std::declval<detail::on_each_arg<Fn&>>())) {
-        return unpack(static_cast<V&&>(V), detail::on_each_arg<Fn&>{fn});
+        -> decltype(unpack(std::declval<V&&>(), std::declval<detail::on_each_arg<Fn&>>())) {
+        return unpack(static_cast<V&&>(v), detail::on_each_arg<Fn&>{fn});
     }
 };
 
@@ -0,0 +1,120 @@
+// Copyright Victor Smirnov 2021-2022
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+//
+// The documentation can be found at the library's page:
+// https://github.com/Ariox41/tmdesc
+
+#pragma once
+#include "member_name.hpp"
+#include "member_table.hpp"
+#include "type_info/detail/companion_info.hpp"
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace tmdesc {
+template <class T> class atomic_struct;
+
+namespace detail {
+template <class M, bool Described = has_static_members<M>::value> struct atomic_member {
+    static_assert(std::is_arithmetic<M>::value || std::is_enum<M>::value || std::is_pointer<M>::value,
+                  "atomic_struct members must be scalars or described types");
+    using type = std::atomic<M>;
+};
+/// nested described types are stored as nested atomic structs
+template <class M> struct atomic_member<M, true> {
+    using type = atomic_struct<M>;
+};
+template <class M> using atomic_member_t = typename atomic_member<M>::type;
+
+template <class T, std::size_t I> struct atomic_field {
+    using member_info_type = std::decay_t<decltype(at_c<I>(static_type_members_v<T>.value()))>;
+    using value_type       = typename member_info_type::value_type;
+
+    atomic_member_t<value_type> value{};
+};
+
+template <class T, class Indices> struct atomic_fields;
+template <class T, std::size_t... Is> struct atomic_fields<T, std::index_sequence<Is...>> : atomic_field<T, Is>... {
+    void load_into(T& out, std::memory_order order) const noexcept {
+        bool unused[] = {
+            true, (at_c<Is>(static_type_members_v<T>.value()).getter()(out) = atomic_field<T, Is>::value.load(order),
+                   true)...};
+        (void)unused;
+    }
+    void store_from(const T& in, std::memory_order order) noexcept {
+        bool unused[] = {
+            true, (atomic_field<T, Is>::value.store(at_c<Is>(static_type_members_v<T>.value()).getter()(in), order),
+                   true)...};
+        (void)unused;
+    }
+};
+
+template <class T, class Impl, std::size_t... Is>
+constexpr auto atomic_struct_info(info_builder<atomic_struct<T>, Impl> b, std::index_sequence<Is...>) {
+    return make_companion_type_info<T>(b, make_companion_member_info<atomic_struct<T>, T, Is>(
+                                              &atomic_field<T, Is>::value)...);
+}
+} // namespace detail
+
+/** Companion of the described type `T` where each member is `std::atomic`, for concurrent updates of the members.
+
+    @details
+    Scalar members of `T` are stored as `std::atomic<M>`, nested described types as `atomic_struct<M>`.
+    The atomic struct is described itself, with the member names and attributes of `T`, so it is used
+    with @ref members_view and @ref get_member like `T`:
+    @code
+    tmdesc::atomic_struct<stats> s;
+    s.fetch_add<TMDESC_NAME("requests")>(1, std::memory_order_relaxed);    // from any thread
+    tmdesc::get_member<TMDESC_NAME("errors")>(s).store(0);                 // std::atomic<std::uint64_t>&
+    stats snapshot = s.load(std::memory_order_relaxed);
+    @endcode
+    @note @ref load and @ref store access the members one by one, the copy is not consistent if members are
+    changed concurrently, see @ref seqlock for consistent copies.
+ */
+template <class T>
+class atomic_struct : public detail::atomic_fields<T, std::make_index_sequence<detail::members_count_v<T>>> {
+    static_assert(detail::has_static_members<T>::value, "the type has no members description");
+
+public:
+    using value_type = T;
+
+    atomic_struct() noexcept = default;
+    explicit atomic_struct(const T& value) noexcept { store(value, std::memory_order_relaxed); }
+    atomic_struct(const atomic_struct&) = delete;
+    atomic_struct& operator=(const atomic_struct&) = delete;
+
+    /// @return the copy of the members, each member is loaded with the `order`
+    T load(std::memory_order order = std::memory_order_seq_cst) const noexcept {
+        T result{};
+        this->load_into(result, order);
+        return result;
+    }
+
+    /// Stores each member of the value with the `order`
+    void store(const T& value, std::memory_order order = std::memory_order_seq_cst) noexcept {
+        this->store_from(value, order);
+    }
+
+    /// Atomically adds `delta` to the member with the name `Name`, see @ref TMDESC_NAME
+    /// @return the previous value of the member
+    template <class Name, class V>
+    auto fetch_add(V delta, std::memory_order order = std::memory_order_seq_cst) noexcept {
+        return get_member<Name>(*this).fetch_add(delta, order);
+    }
+
+    /// Atomically subtracts `delta` from the member with the name `Name`, see @ref TMDESC_NAME
+    /// @return the previous value of the member
+    template <class Name, class V>
+    auto fetch_sub(V delta, std::memory_order order = std::memory_order_seq_cst) noexcept {
+        return get_member<Name>(*this).fetch_sub(delta, order);
+    }
+
+    template <class Impl> friend constexpr auto tmdesc_info(info_builder<atomic_struct, Impl> b) {
+        return detail::atomic_struct_info(b, std::make_index_sequence<detail::members_count_v<T>>{});
+    }
+};
+
+} // namespace tmdesc
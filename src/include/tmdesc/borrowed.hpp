@@ -0,0 +1,52 @@
+// Copyright Victor Smirnov 2021-2022
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+//
+// The documentation can be found at the library's page:
+// https://github.com/Ariox41/tmdesc
+
+#pragma once
+#include "core/integral_constant.hpp"
+#include "string_view.hpp"
+#include "type_info/get_type_info.hpp"
+#include <type_traits>
+
+namespace tmdesc {
+
+/// Checks whether the values of type `T` refer to a string instead of owning it.
+///
+/// @note Only @ref string_view is borrowed by default.
+/// @ref zstring_view requires the null terminator, which is generally absent in the decoder input buffer.
+template <class T> struct is_borrowed_string : std::is_same<T, string_view> {};
+template <class T> constexpr bool is_borrowed_string_v = is_borrowed_string<T>::value;
+
+/** Checks whether the decoder can store the member as a view into the input buffer instead of copying the string.
+
+    @details
+    The member is borrowed if it has type @ref string_view,
+    or if it is marked with @ref tags::borrowed attribute (see `info_builder::borrowed`).
+    In the second case the member type must be constructible from `(const char*, std::size_t)`.
+
+    The decoder stores a borrowed member as `M(src.data(), src.size())`, where `src` is a part of the input buffer:
+    a string of the binary format or a JSON string without escapes.
+    The input buffer must outlive the decoded object.
+    If the string can't be referenced directly (for example, a JSON string with escapes), the decoding fails.
+
+    @tparam MemberInfo - @ref member_info type
+ */
+template <class MemberInfo> struct is_borrowed_member;
+
+namespace detail {
+template <class AS> using has_borrowed_attribute = has_key<AS, tags::borrowed>;
+} // namespace detail
+
+template <class M, class Getter, class AS>
+struct is_borrowed_member<member_info<M, Getter, AS>>
+  : bool_constant<is_borrowed_string<M>::value || detail::has_borrowed_attribute<AS>::value> {
+    static_assert(!detail::has_borrowed_attribute<AS>::value || std::is_constructible<M, const char*, std::size_t>{},
+                  "the borrowed member must be constructible from (const char*, std::size_t)");
+};
+template <class MemberInfo> struct is_borrowed_member<const MemberInfo> : is_borrowed_member<MemberInfo> {};
+template <class MemberInfo> constexpr bool is_borrowed_member_v = is_borrowed_member<MemberInfo>::value;
+
+} // namespace tmdesc
@@ -0,0 +1,281 @@
+// Copyright Victor Smirnov 2021-2022
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+//
+// The documentation can be found at the library's page:
+// https://github.com/Ariox41/tmdesc
+
+#pragma once
+#include "algorithm/unpack.hpp"
+#include "containers/perfect_hash.hpp"
+#include "member_table.hpp"
+#include "type_info/detail/companion_info.hpp"
+#include "type_info/member_index.hpp"
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+/// Size of the cache line used by the false sharing audit and @ref tmdesc::padded_layout
+#ifndef TMDESC_CACHE_LINE_SIZE
+#define TMDESC_CACHE_LINE_SIZE 64
+#endif
+
+namespace tmdesc {
+
+/// Size of the cache line, see @ref TMDESC_CACHE_LINE_SIZE
+constexpr std::size_t cache_line_size = TMDESC_CACHE_LINE_SIZE;
+
+/// Result of the false sharing audit, see @ref false_sharing_report_v and @ref audit_false_sharing.
+struct false_sharing_report {
+    /// `false` if the member offsets are not known, then the conflicts are not searched
+    bool layout_known;
+    /// `true` if the conflicts are searched with the real member offsets, see @ref audit_false_sharing
+    bool layout_verified;
+    /// count of the member pairs which share the cache line but are written by different groups
+    std::size_t conflicts;
+    /// name of the first member of the first conflicting pair
+    zstring_view first;
+    /// name of the second member of the first conflicting pair
+    zstring_view second;
+
+    /// @return `true` if the real layout is checked and has no conflicts
+    constexpr bool ok() const noexcept { return layout_verified && conflicts == 0; }
+};
+
+namespace detail {
+struct cache_layout_member {
+    zstring_view name;
+    std::size_t offset;
+    std::size_t size;
+    std::size_t align;
+    std::size_t group;
+    bool hot;
+};
+
+template <class AS, bool = has_key<AS, tags::cache_line_group>::value> struct cache_line_group_of {
+    static constexpr std::size_t get(const AS&) noexcept { return 0; }
+};
+template <class AS> struct cache_line_group_of<AS, true> {
+    static constexpr std::size_t get(const AS& attributes) noexcept {
+        return at_key(attributes, type_c<tags::cache_line_group>);
+    }
+};
+
+struct make_cache_layout_members_t {
+    template <class MemberInfo> static constexpr cache_layout_member make(const MemberInfo& mi) noexcept {
+        using value_type     = typename MemberInfo::value_type;
+        using attribute_type = std::decay_t<decltype(mi.attributes())>;
+        return {mi.name(),
+                0,
+                sizeof(value_type),
+                alignof(value_type),
+                cache_line_group_of<attribute_type>::get(mi.attributes()),
+                has_key<attribute_type, tags::hot_write>::value};
+    }
+    template <class... MemberInfos>
+    constexpr constexpr_array<cache_layout_member, sizeof...(MemberInfos)>
+    operator()(const MemberInfos&... mi) const noexcept {
+        return {{make(mi)...}};
+    }
+};
+
+/// members may share the cache line only if they are in the same group and are both hot or both not
+constexpr bool may_share_cache_line(const cache_layout_member& a, const cache_layout_member& b) noexcept {
+    return a.group == b.group && a.hot == b.hot;
+}
+
+constexpr bool share_cache_line(const cache_layout_member& a, const cache_layout_member& b) noexcept {
+    return a.offset / cache_line_size <= (b.offset + b.size - 1) / cache_line_size &&
+           b.offset / cache_line_size <= (a.offset + a.size - 1) / cache_line_size;
+}
+
+constexpr std::size_t align_up(std::size_t value, std::size_t align) noexcept {
+    return (value + align - 1) / align * align;
+}
+
+/// Member offsets in the declaration order with the natural alignment of the member types
+template <std::size_t N>
+constexpr constexpr_array<cache_layout_member, N> declaration_layout(constexpr_array<cache_layout_member, N> members) {
+    std::size_t end = 0;
+    for (std::size_t i = 0; i < N; ++i) {
+        members[i].offset = align_up(end, members[i].align);
+        end               = members[i].offset + members[i].size;
+    }
+    return members;
+}
+
+/// alignment of the type with the layout of @ref declaration_layout
+template <std::size_t N>
+constexpr std::size_t declaration_layout_align(const constexpr_array<cache_layout_member, N>& members) noexcept {
+    std::size_t align = 1;
+    for (std::size_t i = 0; i < N; ++i)
+        align = align < members[i].align ? members[i].align : align;
+    return align;
+}
+
+/// size of the type with the layout of @ref declaration_layout, the empty type has the size 1
+template <std::size_t N>
+constexpr std::size_t declaration_layout_size(const constexpr_array<cache_layout_member, N>& members) noexcept {
+    return N == 0 ? 1 : align_up(members[N - 1].offset + members[N - 1].size, declaration_layout_align(members));
+}
+
+template <std::size_t N>
+constexpr false_sharing_report find_false_sharing(const constexpr_array<cache_layout_member, N>& members,
+                                                  bool layout_known, bool layout_verified) noexcept {
+    false_sharing_report report{layout_known, layout_verified, 0, {}, {}};
+    for (std::size_t i = 0; layout_known && i < N; ++i) {
+        for (std::size_t j = i + 1; j < N; ++j) {
+            if (may_share_cache_line(members[i], members[j]) || !share_cache_line(members[i], members[j]))
+                continue;
+            if (report.conflicts++ == 0) {
+                report.first  = members[i].name;
+                report.second = members[j].name;
+            }
+        }
+    }
+    return report;
+}
+
+/// Member offsets of the described type `T` calculated at compile time.
+/// @details C++14 has no constant expression for the member offset, so the offsets are calculated from the member
+/// types in the declaration order, and the result is accepted if the calculated size and alignment are equal to
+/// `sizeof(T)` and `alignof(T)`. The `alignas` of a member is not visible in its type, so the layout with
+/// over-aligned members is not guessed: it would match `sizeof(T)` with wrong offsets.
+/// The description order is not visible either, so the calculated offsets are never verified.
+template <class T> struct cache_layout {
+    static constexpr std::size_t size = members_count_v<T>;
+    static constexpr constexpr_array<cache_layout_member, size> described =
+        unpack(static_type_members_v<T>.value(), make_cache_layout_members_t{});
+
+    static constexpr constexpr_array<cache_layout_member, size> natural = declaration_layout(described);
+    static constexpr bool natural_known = std::is_standard_layout<T>::value &&
+                                          declaration_layout_size(natural) == sizeof(T) &&
+                                          declaration_layout_align(natural) == alignof(T);
+
+    static constexpr false_sharing_report report = find_false_sharing(natural, natural_known, false);
+};
+template <class T> constexpr std::size_t cache_layout<T>::size;
+template <class T> constexpr constexpr_array<cache_layout_member, cache_layout<T>::size> cache_layout<T>::described;
+template <class T> constexpr constexpr_array<cache_layout_member, cache_layout<T>::size> cache_layout<T>::natural;
+template <class T> constexpr bool cache_layout<T>::natural_known;
+template <class T> constexpr false_sharing_report cache_layout<T>::report;
+} // namespace detail
+
+/** Compile-time audit of false sharing in the described type `T`.
+
+    @details
+    The members are marked by the @ref tags::cache_line_group attribute (the members without it belong to
+    the group 0) and the @ref tags::hot_write attribute. Two members are the conflict if they share the cache line,
+    but belong to different groups, or only one of them is hot:
+    @code
+    struct queue_state {
+        std::uint64_t head;
+        std::uint64_t tail;
+
+        template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<queue_state, Impl> b) {
+            return b.type(b.members(b.member("head", &queue_state::head, b.attributes(b.cache_line_group(1))),
+                                    b.member("tail", &queue_state::tail, b.attributes(b.cache_line_group(2)))));
+        }
+    };
+    static_assert(tmdesc::false_sharing_report_v<queue_state>.conflicts != 0, "head and tail share the cache line");
+    @endcode
+
+    The member offsets are calculated from the member types in the description order with their natural alignment,
+    so the compile-time report is a hint: it has `layout_verified == false` and never passes `ok()`.
+    If the calculated layout does not match `sizeof(T)` and `alignof(T)` (the type is not standard layout,
+    not all members are described, or some member is declared with `alignas`), the report has
+    `layout_known == false` and no conflicts. The members described out of the declaration order are not detected:
+    the calculated layout may match `sizeof(T)` with wrong offsets, then the report may miss conflicts or find
+    false ones. Only @ref audit_false_sharing checks the real offsets, at runtime:
+    @code
+    struct padded_queue_state {
+        alignas(tmdesc::cache_line_size) std::uint64_t head;
+        alignas(tmdesc::cache_line_size) std::uint64_t tail;
+        ...
+    };
+    assert(tmdesc::audit_false_sharing<padded_queue_state>().ok());
+    @endcode
+ */
+template <class T> constexpr false_sharing_report false_sharing_report_v = detail::cache_layout<T>::report;
+
+/// The false sharing audit of the described type `T` with the real member offsets, see @ref false_sharing_report_v
+template <class T> false_sharing_report audit_false_sharing() noexcept {
+    auto members              = detail::cache_layout<T>::described;
+    const member_table& table = member_table_of<T>();
+    for (std::size_t i = 0; i < table.size(); ++i)
+        members[i].offset = table[i].offset;
+    return detail::find_false_sharing(members, true, true);
+}
+
+template <class T> class padded_layout;
+
+namespace detail {
+template <class T, std::size_t I> constexpr bool starts_cache_line() noexcept {
+    return I == 0 || !may_share_cache_line(cache_layout<T>::described[I - 1], cache_layout<T>::described[I]);
+}
+
+template <class T, std::size_t I, bool Aligned = starts_cache_line<T, I>()> struct padded_field {
+    using value_type = typename std::decay_t<decltype(at_c<I>(static_type_members_v<T>.value()))>::value_type;
+    value_type value{};
+};
+template <class T, std::size_t I> struct padded_field<T, I, true> {
+    using value_type = typename std::decay_t<decltype(at_c<I>(static_type_members_v<T>.value()))>::value_type;
+    alignas(cache_line_size) value_type value{};
+};
+
+template <class T, class Indices> struct padded_fields;
+template <class T, std::size_t... Is> struct padded_fields<T, std::index_sequence<Is...>> : padded_field<T, Is>... {
+    void load_into(T& out) const {
+        bool unused[] = {
+            true, (at_c<Is>(static_type_members_v<T>.value()).getter()(out) = padded_field<T, Is>::value, true)...};
+        (void)unused;
+    }
+    void store_from(const T& in) {
+        bool unused[] = {
+            true, (padded_field<T, Is>::value = at_c<Is>(static_type_members_v<T>.value()).getter()(in), true)...};
+        (void)unused;
+    }
+};
+
+template <class T, class Impl, std::size_t... Is>
+constexpr auto padded_layout_info(info_builder<padded_layout<T>, Impl> b, std::index_sequence<Is...>) {
+    return make_companion_type_info<T>(b, make_companion_member_info<padded_layout<T>, T, Is>(
+                                              &padded_field<T, Is>::value)...);
+}
+} // namespace detail
+
+/** Companion of the described type `T` where each group of members starts the cache line.
+
+    @details
+    The members are split by the @ref tags::cache_line_group and @ref tags::hot_write attributes,
+    as in @ref false_sharing_report_v, the first member of each group is aligned by @ref cache_line_size.
+    The companion is described with the member names and attributes of `T`, so it is used with
+    @ref members_view and @ref get_member like `T`, and @ref audit_false_sharing reports no conflicts for it.
+    @note The companion is over-aligned, C++14 `operator new` does not respect it for dynamic allocation.
+ */
+template <class T>
+class padded_layout : public detail::padded_fields<T, std::make_index_sequence<detail::members_count_v<T>>> {
+    static_assert(detail::has_static_members<T>::value, "the type has no members description");
+
+public:
+    using value_type = T;
+
+    padded_layout() = default;
+    explicit padded_layout(const T& value) { this->store_from(value); }
+
+    /// @return the copy of the members in the type `T`
+    T unpadded() const {
+        T result{};
+        this->load_into(result);
+        return result;
+    }
+
+    /// Copies the members of `value`
+    void assign(const T& value) { this->store_from(value); }
+
+    template <class Impl> friend constexpr auto tmdesc_info(info_builder<padded_layout, Impl> b) {
+        return detail::padded_layout_info(b, std::make_index_sequence<detail::members_count_v<T>>{});
+    }
+};
+
+} // namespace tmdesc
@@ -8,6 +8,7 @@
 #include "../containers/optional.hpp"
 #include "../core/implementable_function.hpp"
 #include "../meta/tag_of.hpp"
+#include <type_traits>
 
 namespace tmdesc {
 
@@ -32,5 +33,57 @@ struct find_if_t {
 };
 
 /// Finds a value whose key satisfies the predicate and returns some(value) or none
+/// @details The search is done at compile time, the predicate is checked with the compile-time key of each element:
+/// `type_c<Key>` for dict, `type_c<T>` of the element type for tuple, @ref member_info for members view.
+/// If the predicate returns `true_type`/`false_type`, only the result type is used, so the predicate may be
+/// a stateful object or a lambda. A predicate returning `bool` must be an empty default-constructible literal type,
+/// it is invoked in the constant expression.
 constexpr find_if_t find_if{};
+
+namespace detail {
+template <class Key> struct equal_key {
+    template <class U>
+    constexpr bool_constant<std::is_same<std::decay_t<U>, Key>::value> operator()(const U&) const noexcept {
+        return {};
+    }
+};
+} // namespace detail
+
+/// `find` implementation for searchable type.
+/// The default implementation is `find_if` with the predicate comparing the key types.
+template <class T, class Enable = void> struct find_impl : core::default_implementation {
+    /// Finds a value with the key and returns some(value) or none
+    template <class C, class Key>
+    static constexpr auto apply(C&& container, const Key&) //
+        noexcept(noexcept(find_if(std::declval<C>(), detail::equal_key<Key>{})))
+            -> decltype(find_if(std::declval<C>(), detail::equal_key<Key>{})) {
+        return find_if(std::forward<C>(container), detail::equal_key<Key>{});
+    }
+};
+
+struct find_t {
+    template <class T> using impl_t = find_impl<meta::tag_of_t<T>>;
+
+    template <class T, class Key, std::enable_if_t<Searchable<typename meta::tag_of<T>::type>{}, bool> = true>
+    constexpr auto operator()(T&& v, const Key& key) const //
+        noexcept(noexcept(impl_t<T>::apply(std::declval<T>(), key)))
+            -> decltype(impl_t<T>::apply(std::declval<T>(), key)) {
+        return impl_t<T>::apply(std::forward<T>(v), key);
+    }
+};
+
+/// Finds a value with the key and returns some(value) or none
+/// @details The key is compared by the type, for example `find(dict, type_c<Key>)`.
+constexpr find_t find{};
+
+struct contains_t {
+    template <class T, class Key>
+    constexpr auto operator()(T&& v, const Key& key) const noexcept
+        -> decltype(is_some(find(std::declval<T>(), key))) {
+        return {};
+    }
+};
+
+/// Checks whether the container contains the key, returns `true_type` or `false_type`
+constexpr contains_t contains{};
 } // namespace tmdesc
@@ -20,7 +20,9 @@ template <class K, class V> struct ebo<K, V, true> : V {
     constexpr ebo& operator=(ebo&&) = default;
     constexpr ebo& operator=(const ebo&) = default;
 
-    using V::V;
+    template <class T, std::enable_if_t<std::is_constructible<V, T&&>{}, bool> = true>
+    explicit constexpr ebo(T&& t)
+      : V(static_cast<T&&>(t)) {}
 };
 
 // Specialize ebo for non-empty types
@@ -64,4 +66,4 @@ template <class V, class K> constexpr V&& ebo_get_by_value(ebo<K, V, false>&& x)
     return static_cast<V&&>(x.data_);
 }
 } // namespace detail
-} // namespace tmdesc
\ No newline at end of file
+} // namespace tmdesc
\ No newline at end of file
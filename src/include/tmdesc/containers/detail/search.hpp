@@ -0,0 +1,61 @@
+// Copyright Victor Smirnov 2021-2022
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+//
+// The documentation can be found at the library's page:
+// https://github.com/Ariox41/tmdesc
+
+#pragma once
+#include "../../functional/invoke.hpp"
+#include "../optional.hpp"
+#include <cstddef>
+#include <type_traits>
+
+namespace tmdesc {
+namespace detail {
+/// index of the first true value or `sizeof...(BS)`
+template <bool... BS> constexpr std::size_t first_true_index() noexcept {
+    constexpr bool values[] = {BS..., true};
+    std::size_t i           = 0;
+    while (!values[i])
+        ++i;
+    return i;
+}
+
+template <class T, T V> std::true_type is_constant_result_test(const std::integral_constant<T, V>*);
+std::false_type is_constant_result_test(const void*);
+
+/// Result type of the search predicate `P` for the compile-time `key`
+template <class P, class Key>
+using search_predicate_result_t = std::decay_t<decltype(invoke(std::declval<const P&>(), std::declval<const Key&>()))>;
+
+/// `true_type` if the result is derived from `std::integral_constant`, so the predicate is not evaluated
+template <class P, class Key>
+using is_constant_search_predicate =
+    decltype(is_constant_result_test(static_cast<search_predicate_result_t<P, Key>*>(nullptr)));
+
+template <class P, class Key> constexpr bool search_predicate_value(const Key&, std::true_type) noexcept {
+    return static_cast<bool>(search_predicate_result_t<P, Key>::value);
+}
+template <class P, class Key> constexpr bool search_predicate_value(const Key& key, std::false_type) noexcept {
+    static_assert(std::is_empty<P>::value && std::is_default_constructible<P>::value,
+                  "the search predicate returning a runtime value must be an empty default-constructible literal type, "
+                  "or return true_type/false_type");
+    return static_cast<bool>(invoke(P{}, key));
+}
+
+/// Value of the search predicate `P` for the compile-time `key`.
+/// @details If the result type is `true_type`/`false_type` (any `std::integral_constant`), the value is taken
+/// from the type, so the predicate may have a state and may be a lambda.
+/// Otherwise `P` must be an empty default-constructible literal type, it is invoked in the constant expression.
+template <class P, class Key> constexpr bool search_predicate_value(const Key& key) noexcept {
+    return search_predicate_value<P>(key, is_constant_search_predicate<P, Key>{});
+}
+
+/// result of the search: a reference to the element of lvalue container, or a value moved from rvalue container
+template <class R> struct find_result { using type = some_t<R>; };
+template <class V> struct find_result<V&&> { using type = some_t<V>; };
+
+template <class R> using find_result_t = typename find_result<R>::type;
+} // namespace detail
+} // namespace tmdesc
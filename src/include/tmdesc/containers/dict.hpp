@@ -6,29 +6,148 @@
 // https://github.com/Ariox41/tmdesc
 
 #pragma once
-#include "../../meta/integral_constant.hpp"
-#include "../../meta/logical_operations.hpp"
-#include "ebo.hpp"
+#include "../concepts/searchable.hpp"
+#include "../core/integral_constant.hpp"
+#include "../core/type_t.hpp"
+#include "../meta/logical_operations.hpp"
+#include "../meta/void_t.hpp"
+#include "detail/ebo.hpp"
+#include "detail/search.hpp"
+#include "optional.hpp"
+#include "pair.hpp"
+#include <type_traits>
+#include <utility>
+
 namespace tmdesc {
+
+/** Compile-time heterogeneous dictionary {key type -> value}.
+
+    @details
+    `dict<pair<Key, Value>...>` stores a value for each key, the key is a type without value.
+    The dict inherits `ebo<Key, Value>` for each key, so the lookup by key is a single overload resolution
+    on the base classes, without recursive instantiation: `at_key(d, type_c<Key>)`.
+    `find(d, type_c<Key>)` returns `some(value)` or `none`, `contains(d, type_c<Key>)` returns `true_type`
+    or `false_type`, `find_if(d, predicate)` searches the first key for which `predicate(type_c<Key>)`
+    is true, see @ref find_if.
+
+    @note Keys must be unique, duplicate keys make the dict ill-formed (duplicate base class).
+    @note `pair<Key, Value>` is used only as the template argument, the dict does not contain pair objects.
+ */
+template <class... Pairs> struct dict;
+
+template <class... Ks, class... Vs> struct dict<pair<Ks, Vs>...> final : detail::ebo<Ks, Vs>... {
+    constexpr dict()            = default;
+    constexpr dict(const dict&) = default;
+    constexpr dict(dict&&)      = default;
+    constexpr dict& operator=(const dict&) = default;
+    constexpr dict& operator=(dict&&) = default;
+
+    /// Direct initialisation constructor, values are in the order of keys
+    template <class... Args,
+              std::enable_if_t<meta::recursive_and_v<bool_constant<(sizeof...(Args) >= 1)>,
+                                                     bool_constant<(sizeof...(Vs) == sizeof...(Args))>,
+                                                     meta::fast_values_and<std::is_constructible<Vs, Args&&>...>>,
+                               bool> = true>
+    explicit constexpr dict(Args&&... args) noexcept(
+        meta::fast_values_and_v<std::is_nothrow_constructible<Vs, Args&&>...>)
+      : detail::ebo<Ks, Vs>{static_cast<Args&&>(args)}... {}
+};
+
+/// tag of dict
+struct dict_tag {};
+
+namespace meta {
+/// dict tag
+template <class... Ps> struct tag_of<dict<Ps...>> { using type = dict_tag; };
+} // namespace meta
+
 namespace detail {
-template <class Indexer, class... Ts> struct tuple_storage;
+template <class K, class D, class = void> struct dict_has_key : false_type {};
+template <class K, class D>
+struct dict_has_key<K, D, meta::void_t<decltype(detail::ebo_get<K>(std::declval<const D&>()))>> : true_type {};
+} // namespace detail
 
-template <std::size_t... Is, class... Ts>
-struct tuple_storage<std::index_sequence<Is...>, Ts...> : public detail::ebo<size_constant<Is>, Ts>... {
-protected:
-    constexpr tuple_storage()                     = default;
-    constexpr tuple_storage(tuple_storage&&)      = default;
-    constexpr tuple_storage(const tuple_storage&) = default;
-    constexpr tuple_storage& operator=(tuple_storage&&) = default;
-    constexpr tuple_storage& operator=(const tuple_storage&) = default;
-
-    struct direct_constructor {};
-
-    template <class... Args>
-    constexpr tuple_storage(direct_constructor, Args&&... args) noexcept(
-        meta::fast_values_and_v<std::is_nothrow_constructible<Ts, Args&&>...>)
-      : detail::ebo<size_constant<Is>, Ts>{std::forward<Args>(args)}... {}
+/// Checks whether the dict `D` contains the key `K`
+template <class D, class K> struct has_key : detail::dict_has_key<K, std::decay_t<D>> {};
+template <class D, class K> constexpr bool has_key_v = has_key<D, K>::value;
+
+/// Returns a reference to the value with the key `K`. The dict must contain the key.
+/// at_key({k0: v0, k1: v1, ..., kN: vN}, type_c<kI>) => vI
+#ifdef TMDESC_DOXYGEN
+constexpr auto at_key = [](auto&& d, type_t<K> key) -> auto&& { /*...*/ };
+#else
+struct at_key_t {
+    template <class D, class K>
+    constexpr auto operator()(D&& d, type_t<K>) const noexcept
+        -> decltype(detail::ebo_get<K>(std::declval<D>())) {
+        return detail::ebo_get<K>(static_cast<D&&>(d));
+    }
 };
+constexpr at_key_t at_key{};
+#endif
+
+/// ===============================
+///            Searchable
+/// ===============================
 
+namespace detail {
+template <std::size_t I, class T> struct indexed_type { using type = T; };
+
+template <class Indices, class... Ts> struct indexed_types;
+template <std::size_t... Is, class... Ts>
+struct indexed_types<std::index_sequence<Is...>, Ts...> : indexed_type<Is, Ts>... {};
+
+template <std::size_t I, class T> indexed_type<I, T> select_indexed_type(const indexed_type<I, T>&) noexcept;
+
+/// `Ts[I]` without recursive instantiation
+template <std::size_t I, class... Ts>
+using type_at_t = typename decltype(
+    select_indexed_type<I>(std::declval<indexed_types<std::make_index_sequence<sizeof...(Ts)>, Ts...>>()))::type;
+
+template <class K, class D>
+constexpr find_result_t<decltype(ebo_get<K>(std::declval<D>()))> dict_find(D&& d, true_type) noexcept(
+    std::is_nothrow_constructible<find_result_t<decltype(ebo_get<K>(std::declval<D>()))>,
+                                  decltype(ebo_get<K>(std::declval<D>()))>::value) {
+    return find_result_t<decltype(ebo_get<K>(std::declval<D>()))>(ebo_get<K>(static_cast<D&&>(d)));
+}
+template <class K, class D> constexpr none_t dict_find(D&&, false_type) noexcept { return none; }
+
+/// `type_c<Key>` of the first key satisfying the predicate or `none`
+template <class P, class... Ks, class... Vs>
+constexpr auto dict_find_key(const dict<pair<Ks, Vs>...>&) noexcept {
+    constexpr std::size_t index = first_true_index<search_predicate_value<P>(type_c<Ks>)...>();
+    return std::conditional_t<(index < sizeof...(Ks)), type_t<type_at_t<index, Ks..., void>>, none_t>{};
+}
 } // namespace detail
+
+/// `find_if` implementation for dict, the predicate is invoked with `type_c<Key>` of each key
+template <> struct find_if_impl<dict_tag> {
+    template <class D, class P>
+    using found_key = decltype(detail::dict_find_key<std::decay_t<P>>(std::declval<const std::decay_t<D>&>()));
+
+    template <class D, class K>
+    static constexpr auto apply_key(D&& d, type_t<K>) noexcept(noexcept(detail::dict_find<K>(std::declval<D>(), true_c)))
+        -> decltype(detail::dict_find<K>(std::declval<D>(), true_c)) {
+        return detail::dict_find<K>(static_cast<D&&>(d), true_c);
+    }
+    template <class D> static constexpr none_t apply_key(D&&, none_t) noexcept { return none; }
+
+    /// Finds a value whose key satisfies the predicate and returns some(value) or none
+    template <class D, class P>
+    static constexpr auto apply(D&& d, P&&) noexcept(noexcept(apply_key(std::declval<D>(), found_key<D, P>{})))
+        -> decltype(apply_key(std::declval<D>(), found_key<D, P>{})) {
+        return apply_key(static_cast<D&&>(d), found_key<D, P>{});
+    }
+};
+
+/// `find` implementation for dict, the key lookup is a single overload resolution
+template <> struct find_impl<dict_tag> {
+    template <class D, class K>
+    static constexpr auto apply(D&& d, type_t<K>) noexcept(
+        noexcept(detail::dict_find<K>(std::declval<D>(), has_key<D, K>{})))
+        -> decltype(detail::dict_find<K>(std::declval<D>(), has_key<D, K>{})) {
+        return detail::dict_find<K>(static_cast<D&&>(d), has_key<D, K>{});
+    }
+};
+
 } // namespace tmdesc
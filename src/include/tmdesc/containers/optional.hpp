@@ -40,12 +40,12 @@ private:
 };
 // TODO do we need it?
 template <class T> struct optional<T&> {
-    constexpr optional(T& ref)
+    constexpr optional(T& ref) noexcept
       : ref_(ref) {}
     constexpr optional(const optional&) = default;
     constexpr optional& operator=(const optional&) = default;
 
-    constexpr T& value() const { return ref_; }
+    constexpr T& value() const noexcept { return ref_; }
 
 private:
     T& ref_;
@@ -66,7 +66,7 @@ template <class T> using some_t = optional<T>;
 using none_t                    = optional<>;
 
 template <class T>
-some_t<std::decay_t<T>> some(T&& v) noexcept(std::is_nothrow_constructible<std::decay_t<T>, T&&>::value) {
+constexpr some_t<std::decay_t<T>> some(T&& v) noexcept(std::is_nothrow_constructible<std::decay_t<T>, T&&>::value) {
     return some_t<std::decay_t<T>>{static_cast<T&&>(v)};
 }
 
@@ -0,0 +1,177 @@
+// Copyright Victor Smirnov 2021-2022
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+//
+// The documentation can be found at the library's page:
+// https://github.com/Ariox41/tmdesc
+
+#pragma once
+#include "../string_view.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+namespace tmdesc {
+namespace detail {
+/// Array with constexpr mutable access, std::array has no constexpr non-const `operator[]` in c++14.
+template <class T, std::size_t N> struct constexpr_array {
+    T data_[N == 0 ? 1 : N];
+
+    constexpr T& operator[](std::size_t i) noexcept { return data_[i]; }
+    constexpr const T& operator[](std::size_t i) const noexcept { return data_[i]; }
+    static constexpr std::size_t size() noexcept { return N; }
+};
+
+constexpr std::uint64_t fnv1a_hash(string_view str) noexcept {
+    std::uint64_t h = 14695981039346656037ull;
+    for (std::size_t i = 0; i < str.size(); ++i) {
+        h ^= static_cast<unsigned char>(str[i]);
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+/// murmur3 finalizer, gives the independent hash for each seed
+constexpr std::uint64_t mix_hash(std::uint64_t h, std::uint64_t seed) noexcept {
+    h ^= seed * 0x9E3779B97F4A7C15ull;
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ull;
+    h ^= h >> 33;
+    return h;
+}
+
+constexpr std::size_t ceil_pow2(std::size_t n) noexcept {
+    std::size_t r = 1;
+    while (r < n)
+        r <<= 1;
+    return r;
+}
+} // namespace detail
+
+/** Compile-time perfect hash of N distinct strings.
+
+    @details
+    Maps each key to its index in the source array without collisions, the lookup calculates two hashes of the key
+    and compares it with a single candidate key. Unknown strings are reported as `npos`.
+
+    The hash is built by the "hash and displace" scheme: keys are distributed into buckets by the first hash,
+    then for each bucket, starting from the largest one, a seed of the second hash is selected so that all bucket keys
+    fall into free slots. Buckets with a single key store the slot directly.
+
+    @note The construction is intended for the constant evaluation:
+    `static constexpr perfect_hash<N> index{keys};`. Duplicate keys make the construction ill-formed.
+    @note Keys are not copied, the strings must outlive the perfect hash.
+ */
+template <std::size_t N> class perfect_hash {
+public:
+    static constexpr std::size_t npos = string_view::npos;
+
+    /// slots count, the power of two
+    static constexpr std::size_t table_size = detail::ceil_pow2(N == 0 ? 1 : N);
+
+    template <class Key>
+    constexpr perfect_hash(const Key (&keys)[N == 0 ? 1 : N])
+      : perfect_hash(keys, 0) {}
+
+    template <class Keys>
+    explicit constexpr perfect_hash(const Keys& keys, int)
+      : keys_{}
+      , seeds_{}
+      , slots_{} {
+        for (std::size_t i = 0; i < N; ++i)
+            keys_[i] = keys[i];
+        build();
+    }
+
+    static constexpr std::size_t size() noexcept { return N; }
+
+    /// @return index of the key or `npos`
+    constexpr std::size_t find(string_view key) const noexcept {
+        if (N == 0)
+            return npos;
+        const std::uint64_t h   = detail::fnv1a_hash(key);
+        const std::int64_t seed = seeds_[detail::mix_hash(h, 0) & mask];
+        const std::size_t slot  = seed < 0 ? std::size_t(-seed - 1) : detail::mix_hash(h, std::uint64_t(seed)) & mask;
+        const std::size_t index = slots_[slot];
+        return index != npos && keys_[index] == key ? index : npos;
+    }
+
+    /// @return key with index `i`
+    constexpr string_view key(std::size_t i) const noexcept { return keys_[i]; }
+
+private:
+    static constexpr std::size_t mask              = table_size - 1;
+    static constexpr std::uint64_t max_seed_search = 1u << 16;
+
+    constexpr void build() {
+        for (std::size_t i = 0; i < table_size; ++i)
+            slots_[i] = npos;
+        if (N == 0)
+            return;
+
+        detail::constexpr_array<std::uint64_t, N> hashes{};
+        detail::constexpr_array<std::size_t, N> bucket_of{};
+        detail::constexpr_array<std::size_t, table_size> bucket_size{};
+        std::size_t max_bucket_size = 0;
+        for (std::size_t i = 0; i < N; ++i) {
+            hashes[i]    = detail::fnv1a_hash(keys_[i]);
+            bucket_of[i] = detail::mix_hash(hashes[i], 0) & mask;
+            if (++bucket_size[bucket_of[i]] > max_bucket_size)
+                max_bucket_size = bucket_size[bucket_of[i]];
+        }
+
+        // the largest buckets first, while there are many free slots
+        detail::constexpr_array<std::size_t, N> bucket_keys{};
+        detail::constexpr_array<std::size_t, N> candidate_slots{};
+        for (std::size_t current_size = max_bucket_size; current_size > 1; --current_size) {
+            for (std::size_t bucket = 0; bucket < table_size; ++bucket) {
+                if (bucket_size[bucket] != current_size)
+                    continue;
+                std::size_t keys_count = 0;
+                for (std::size_t i = 0; i < N; ++i) {
+                    if (bucket_of[i] == bucket)
+                        bucket_keys[keys_count++] = i;
+                }
+                seeds_[bucket] = std::int64_t(find_seed(hashes, bucket_keys, keys_count, candidate_slots));
+                for (std::size_t k = 0; k < keys_count; ++k)
+                    slots_[candidate_slots[k]] = bucket_keys[k];
+            }
+        }
+
+        std::size_t free_slot = 0;
+        for (std::size_t i = 0; i < N; ++i) {
+            if (bucket_size[bucket_of[i]] != 1)
+                continue;
+            while (slots_[free_slot] != npos)
+                ++free_slot;
+            slots_[free_slot]    = i;
+            seeds_[bucket_of[i]] = -std::int64_t(free_slot) - 1;
+        }
+    }
+
+    template <class Hashes, class BucketKeys, class Slots>
+    constexpr std::uint64_t find_seed(const Hashes& hashes, const BucketKeys& bucket_keys, std::size_t keys_count,
+                                      Slots& candidate_slots) const {
+        for (std::uint64_t seed = 1; seed < max_seed_search; ++seed) {
+            bool ok = true;
+            for (std::size_t k = 0; ok && k < keys_count; ++k) {
+                candidate_slots[k] = detail::mix_hash(hashes[bucket_keys[k]], seed) & mask;
+                ok                 = slots_[candidate_slots[k]] == npos;
+                for (std::size_t j = 0; ok && j < k; ++j)
+                    ok = candidate_slots[j] != candidate_slots[k];
+            }
+            if (ok)
+                return seed;
+        }
+        // not a constant expression: the keys are not unique
+        throw std::logic_error("perfect_hash: duplicate keys");
+    }
+
+    detail::constexpr_array<string_view, N> keys_;
+    detail::constexpr_array<std::int64_t, table_size> seeds_;
+    detail::constexpr_array<std::size_t, table_size> slots_;
+};
+
+} // namespace tmdesc
@@ -8,10 +8,13 @@
 #pragma once
 
 #include "../concepts/finite_indexable.hpp"
+#include "../concepts/searchable.hpp"
+#include "../core/type_t.hpp"
 #include "../functional/invoke.hpp"
 #include "../functional/make.hpp"
 #include "../functional/ref_obj.hpp"
 #include "../meta/logical_operations.hpp"
+#include "detail/search.hpp"
 #include "detail/tuple.hpp"
 
 namespace tmdesc {
@@ -138,6 +141,89 @@ template <> struct size_impl<tuple_tag> {
     }
 };
 
+/// ===============================
+///            Foldable
+/// ===============================
+
+/// `unpack` implementation for tuple
+/// @note It is the same as the `FiniteIndexable` implementation, but without `at` dispatching for each element.
+template <> struct unpack_impl<tuple_tag> {
+    template <class V, class Fn, std::size_t... Is>
+    static constexpr auto apply_impl(V&& v, Fn&& fn, index_sequence<Is...>) noexcept(
+        noexcept(invoke(std::declval<Fn>(), detail::ebo_get<size_constant<Is>>(std::declval<V>())...)))
+        -> decltype(invoke(std::declval<Fn>(), detail::ebo_get<size_constant<Is>>(std::declval<V>())...)) {
+        (void)v; // unused for empty tuple
+        return invoke(std::forward<Fn>(fn), detail::ebo_get<size_constant<Is>>(std::forward<V>(v))...);
+    }
+
+    /// v = [v1, v2, ..., vN] => fn(v1, v2, ..., vN)
+    template <class V, class Fn>
+    static constexpr auto apply(V&& v, Fn&& fn) noexcept(noexcept(
+        apply_impl(std::declval<V>(), std::declval<Fn>(), index_sequence_up_to(size(std::declval<V>())))))
+        -> decltype(apply_impl(std::declval<V>(), std::declval<Fn>(), index_sequence_up_to(size(std::declval<V>())))) {
+        return apply_impl(std::forward<V>(v), std::forward<Fn>(fn), index_sequence_up_to(size(v)));
+    }
+};
+
+/// ===============================
+///            Searchable
+/// ===============================
+
+namespace detail {
+template <std::size_t I, class V>
+constexpr find_result_t<decltype(ebo_get<size_constant<I>>(std::declval<V>()))> tuple_find(V&& v, true_type) noexcept(
+    std::is_nothrow_constructible<find_result_t<decltype(ebo_get<size_constant<I>>(std::declval<V>()))>,
+                                  decltype(ebo_get<size_constant<I>>(std::declval<V>()))>::value) {
+    return find_result_t<decltype(ebo_get<size_constant<I>>(std::declval<V>()))>(
+        ebo_get<size_constant<I>>(static_cast<V&&>(v)));
+}
+template <std::size_t I, class V> constexpr none_t tuple_find(V&&, false_type) noexcept { return none; }
+
+/// index of the first element satisfying the predicate or the tuple size
+template <class P, class V> struct tuple_find_if_index;
+template <class P, class... Ts>
+struct tuple_find_if_index<P, tuple<Ts...>>
+  : size_constant<first_true_index<search_predicate_value<P>(type_t<Ts>{})...>()> {};
+
+/// index of the first element of type `T` or the tuple size
+template <class T, class V> struct tuple_find_index;
+template <class T, class... Ts>
+struct tuple_find_index<T, tuple<Ts...>> : size_constant<first_true_index<std::is_same<Ts, T>::value...>()> {};
+
+template <std::size_t I, class V> using tuple_found = bool_constant<(I < decltype(size(std::declval<V>()))::value)>;
+} // namespace detail
+
+/// `find_if` implementation for tuple.
+/// @details The predicate is invoked with `type_c<T>` of each element type in the constant expression,
+/// see @ref find_if, so the search is done by a single pack expansion.
+template <> struct find_if_impl<tuple_tag> {
+    template <class V, class P> using found_index = detail::tuple_find_if_index<std::decay_t<P>, std::decay_t<V>>;
+
+    /// Finds the first element satisfying the predicate and returns some(element) or none
+    template <class V, class P>
+    static constexpr auto apply(V&& v, P&&) noexcept(noexcept(detail::tuple_find<found_index<V, P>::value>(
+        std::declval<V>(), detail::tuple_found<found_index<V, P>::value, V>{})))
+        -> decltype(detail::tuple_find<found_index<V, P>::value>(
+            std::declval<V>(), detail::tuple_found<found_index<V, P>::value, V>{})) {
+        return detail::tuple_find<found_index<V, P>::value>(
+            static_cast<V&&>(v), detail::tuple_found<found_index<V, P>::value, V>{});
+    }
+};
+
+/// `find` implementation for tuple, `find(t, type_c<T>)` finds the first element of type `T`
+template <> struct find_impl<tuple_tag> {
+    template <class V, class T> using found_index = detail::tuple_find_index<T, std::decay_t<V>>;
+
+    template <class V, class T>
+    static constexpr auto apply(V&& v, type_t<T>) noexcept(noexcept(detail::tuple_find<found_index<V, T>::value>(
+        std::declval<V>(), detail::tuple_found<found_index<V, T>::value, V>{})))
+        -> decltype(detail::tuple_find<found_index<V, T>::value>(
+            std::declval<V>(), detail::tuple_found<found_index<V, T>::value, V>{})) {
+        return detail::tuple_find<found_index<V, T>::value>(
+            static_cast<V&&>(v), detail::tuple_found<found_index<V, T>::value, V>{});
+    }
+};
+
 /// ===============================
 ///               Make
 /// ===============================
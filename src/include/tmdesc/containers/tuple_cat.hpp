@@ -0,0 +1,123 @@
+// Copyright Victor Smirnov 2021-2022
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+//
+// The documentation can be found at the library's page:
+// https://github.com/Ariox41/tmdesc
+
+#pragma once
+#include "../algorithm/unpack.hpp"
+#include "../core/type_t.hpp"
+#include "tuple.hpp"
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace tmdesc {
+namespace detail {
+template <class K, class V, bool B> type_t<V> ebo_value_type(const ebo<K, V, B>&) noexcept;
+
+/// Type of the `I`-th element of the tuple `T` without recursive instantiation
+template <std::size_t I, class T>
+using tuple_element_t = typename decltype(ebo_value_type<size_constant<I>>(std::declval<const T&>()))::type;
+
+/// Position of each element of the concatenated tuple: index of the source tuple and index inside it
+template <std::size_t N> struct tuple_cat_table {
+    std::size_t outer[N == 0 ? 1 : N];
+    std::size_t inner[N == 0 ? 1 : N];
+};
+
+template <std::size_t... Sizes> constexpr std::size_t tuple_cat_size() noexcept {
+    constexpr std::size_t sizes[] = {Sizes..., 0};
+    std::size_t result            = 0;
+    for (std::size_t i = 0; i < sizeof...(Sizes); ++i)
+        result += sizes[i];
+    return result;
+}
+
+template <std::size_t... Sizes> constexpr tuple_cat_table<tuple_cat_size<Sizes...>()> make_tuple_cat_table() noexcept {
+    constexpr std::size_t sizes[] = {Sizes..., 0};
+    tuple_cat_table<tuple_cat_size<Sizes...>()> table{};
+    std::size_t k = 0;
+    for (std::size_t outer = 0; outer < sizeof...(Sizes); ++outer) {
+        for (std::size_t inner = 0; inner < sizes[outer]; ++inner) {
+            table.outer[k] = outer;
+            table.inner[k] = inner;
+            ++k;
+        }
+    }
+    return table;
+}
+
+template <std::size_t... Sizes> struct tuple_cat_indices {
+    static constexpr std::size_t size                 = tuple_cat_size<Sizes...>();
+    static constexpr tuple_cat_table<size> table = make_tuple_cat_table<Sizes...>();
+};
+template <std::size_t... Sizes> constexpr std::size_t tuple_cat_indices<Sizes...>::size;
+template <std::size_t... Sizes>
+constexpr tuple_cat_table<tuple_cat_indices<Sizes...>::size> tuple_cat_indices<Sizes...>::table;
+
+template <class Indices, class Ks, class... Tuples> struct tuple_cat_expand;
+
+/// The result element `K` is `at(at(tuples, outer[K]), inner[K])`, all elements are expanded by a single pack.
+template <class Indices, std::size_t... Ks, class... Tuples>
+struct tuple_cat_expand<Indices, std::index_sequence<Ks...>, Tuples...> {
+    using inputs = tuple<std::decay_t<Tuples>...>;
+    using refs   = tuple<Tuples&&...>;
+    using type   = tuple<tuple_element_t<Indices::table.inner[Ks], tuple_element_t<Indices::table.outer[Ks], inputs>>...>;
+
+    static constexpr type apply(refs&& tuples) noexcept(noexcept(type{
+        ebo_get<size_constant<Indices::table.inner[Ks]>>(ebo_get<size_constant<Indices::table.outer[Ks]>>(
+            std::declval<refs>()))...})) {
+        (void)tuples; // unused for empty result
+        return type{ebo_get<size_constant<Indices::table.inner[Ks]>>(
+            ebo_get<size_constant<Indices::table.outer[Ks]>>(static_cast<refs&&>(tuples)))...};
+    }
+};
+
+template <class... Tuples>
+using tuple_cat_indices_of = tuple_cat_indices<decltype(size(std::declval<const std::decay_t<Tuples>&>()))::value...>;
+
+template <class... Tuples>
+using tuple_cat_result =
+    tuple_cat_expand<tuple_cat_indices_of<Tuples...>, std::make_index_sequence<tuple_cat_indices_of<Tuples...>::size>,
+                     Tuples...>;
+} // namespace detail
+
+/** Concatenates tuples, @see std::tuple_cat.
+
+    @details
+    `tuple_cat(tuple<A, B>{a, b}, tuple<C>{c}) => tuple<A, B, C>{a, b, c}`.
+    The position of each result element is taken from a constexpr table built by a loop over the sizes of the tuples,
+    so the instantiation depth does not depend on the number and sizes of the tuples.
+    Elements of rvalue tuples are moved, elements of lvalue tuples are copied.
+ */
+#ifdef TMDESC_DOXYGEN
+constexpr auto tuple_cat = [](auto&&... tuples) -> tuple</* element types of all tuples */> { /*...*/ };
+#else
+struct tuple_cat_t {
+    template <class... Tuples>
+    constexpr auto operator()(Tuples&&... tuples) const noexcept(noexcept(
+        detail::tuple_cat_result<Tuples...>::apply(std::declval<tuple<Tuples&&...>>())))
+        -> typename detail::tuple_cat_result<Tuples...>::type {
+        return detail::tuple_cat_result<Tuples...>::apply(tuple<Tuples&&...>{static_cast<Tuples&&>(tuples)...});
+    }
+};
+constexpr tuple_cat_t tuple_cat{};
+#endif
+
+/// Concatenates the tuples contained in the tuple: flatten(tuple<tuple<A, B>, tuple<C>>) => tuple<A, B, C>
+#ifdef TMDESC_DOXYGEN
+constexpr auto flatten = [](auto&& tuples) { return unpack(std::forward<decltype(tuples)>(tuples), tuple_cat); };
+#else
+struct flatten_t {
+    template <class Tuples>
+    constexpr auto operator()(Tuples&& tuples) const noexcept(noexcept(unpack(std::declval<Tuples>(), tuple_cat)))
+        -> decltype(unpack(std::declval<Tuples>(), tuple_cat)) {
+        return unpack(static_cast<Tuples&&>(tuples), tuple_cat);
+    }
+};
+constexpr flatten_t flatten{};
+#endif
+
+} // namespace tmdesc
@@ -0,0 +1,145 @@
+// Copyright Victor Smirnov 2021-2022
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+//
+// The documentation can be found at the library's page:
+// https://github.com/Ariox41/tmdesc
+
+#pragma once
+#include "enum_string.hpp"
+#include <cstdint>
+#include <string>
+
+namespace tmdesc {
+
+/** Checks whether the enumeration `E` is described as a set of flags.
+
+    @details
+    The enumeration is described with the @ref tags::flags type attribute (see `info_builder::flags`),
+    each enumerator is a single bit, or zero for the empty set:
+    @code
+    template <class Impl> constexpr auto tmdesc_info(tmdesc::info_builder<permission, Impl> b) {
+        return b.type(b.attributes(b.flags()), b.enumerators(b.enumerator("read", permission::read),
+                                                             b.enumerator("write", permission::write)));
+    }
+    @endcode
+ */
+template <class E, class = void> struct is_flag_enum : false_type {};
+template <class E>
+struct is_flag_enum<E, std::enable_if_t<is_described_enum<E>::value &&
+                                        has_key<decltype(static_type_attributes_v<E>.value()), tags::flags>::value>>
+  : true_type {};
+template <class E> constexpr bool is_flag_enum_v = is_flag_enum<E>::value;
+
+namespace detail {
+template <class E> using flag_bits_t = std::make_unsigned_t<std::underlying_type_t<E>>;
+
+template <class E> constexpr flag_bits_t<E> flag_bits(E value) noexcept { return static_cast<flag_bits_t<E>>(value); }
+
+template <class E> constexpr bool is_valid_flag_description() noexcept {
+    for (std::size_t i = 0; i < enum_index<E>::size; ++i) {
+        const auto bits = flag_bits(static_type_enumerators_v<E>.value()[i].value());
+        if ((bits & (bits - 1)) != 0)
+            return false;
+    }
+    return true;
+}
+
+template <class E> struct flag_enum_check {
+    static_assert(is_valid_flag_description<E>(), "the flag enumerators must be single bits or zero");
+    static constexpr bool value = true;
+};
+
+/// union of the described flags
+template <class E> constexpr flag_bits_t<E> described_flags() noexcept {
+    flag_bits_t<E> result = 0;
+    for (std::size_t i = 0; i < enum_index<E>::size; ++i)
+        result |= flag_bits(static_type_enumerators_v<E>.value()[i].value());
+    return result;
+}
+} // namespace detail
+
+/** Packs the flags into the bitmask, each flag keeps its own bit.
+
+    @details
+    The bit of the flag is its enumerator value, so the packed masks do not change when the enumerators
+    are reordered or added to the description. Bits of the value without the described flag are dropped.
+ */
+template <class E, std::enable_if_t<is_flag_enum<E>::value, bool> = true>
+constexpr std::uint64_t pack_flags(E value) noexcept {
+    static_assert(detail::flag_enum_check<E>::value, "");
+    return std::uint64_t(detail::flag_bits(value) & detail::described_flags<E>());
+}
+
+/// Unpacks the flags from the bitmask created by @ref pack_flags, unknown bits are ignored.
+template <class E, std::enable_if_t<is_flag_enum<E>::value, bool> = true>
+constexpr E unpack_flags(std::uint64_t packed) noexcept {
+    static_assert(detail::flag_enum_check<E>::value, "");
+    return static_cast<E>(static_cast<detail::flag_bits_t<E>>(packed) & detail::described_flags<E>());
+}
+
+/** Appends the `|`-joined names of the flags contained in the value, like `read|write`.
+
+    @details
+    The empty set is written as the name of the zero enumerator if it is described, otherwise nothing is written.
+    Bits of the value without the described flag are dropped.
+ */
+template <class E, std::enable_if_t<is_flag_enum<E>::value, bool> = true>
+void append_flags(E value, std::string& out) {
+    static_assert(detail::flag_enum_check<E>::value, "");
+    const auto bits = detail::flag_bits(value);
+    bool empty      = true;
+    for (const auto& e : static_type_enumerators_v<E>.value()) {
+        const auto flag = detail::flag_bits(e.value());
+        if (flag != 0 && (bits & flag) == flag) {
+            if (!empty)
+                out += '|';
+            out.append(e.name().data(), e.name().size());
+            empty = false;
+        }
+    }
+    if (empty)
+        out += ::tmdesc::to_string(static_cast<E>(0)).c_str();
+}
+
+/// @return the `|`-joined names of the flags contained in the value, see @ref append_flags
+template <class E, std::enable_if_t<is_flag_enum<E>::value, bool> = true>
+std::string flags_to_string(E value) {
+    std::string result;
+    append_flags(value, result);
+    return result;
+}
+
+/** Parses the `|`-joined names of the flags, like `read|write`.
+
+    @details
+    Each name is found in O(1) by the compile-time perfect hash of the enumerator names, spaces around the names
+    are ignored. The empty string is the empty set.
+    @param text - the names of the flags
+    @param value - the result, it is not changed if some name is not found
+    @return `true` if all names are found
+ */
+template <class E, std::enable_if_t<is_flag_enum<E>::value, bool> = true>
+constexpr bool flags_from_string(string_view text, E& value) noexcept {
+    static_assert(detail::flag_enum_check<E>::value, "");
+    detail::flag_bits_t<E> bits = 0;
+    while (!text.empty()) {
+        const std::size_t separator = text.find_first_of('|');
+        string_view name            = text.substr(0, separator);
+        while (name.starts_with(' '))
+            name.remove_prefix(1);
+        while (name.ends_with(' '))
+            name.remove_suffix(1);
+        const std::size_t index = detail::enum_index<E>::by_name.find(name);
+        if (index == string_view::npos)
+            return false;
+        bits |= detail::flag_bits(static_type_enumerators_v<E>.value()[index].value());
+        if (separator == string_view::npos)
+            break;
+        text.remove_prefix(separator + 1);
+    }
+    value = static_cast<E>(bits);
+    return true;
+}
+
+} // namespace tmdesc
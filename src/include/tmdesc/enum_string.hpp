@@ -0,0 +1,164 @@
+// Copyright Victor Smirnov 2021-2022
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+//
+// The documentation can be found at the library's page:
+// https://github.com/Ariox41/tmdesc
+
+#pragma once
+#include "containers/perfect_hash.hpp"
+#include "core/integral_constant.hpp"
+#include "string_view.hpp"
+#include "type_info/get_type_info.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace tmdesc {
+
+/// Checks whether the enumeration `E` has the enumerators description
+template <class E, class = void> struct is_described_enum : false_type {};
+template <class E>
+struct is_described_enum<E, std::enable_if_t<std::is_enum<E>::value &&
+                                             !decltype(is_none(static_type_enumerators_v<E>))::value>>
+  : true_type {};
+template <class E> constexpr bool is_described_enum_v = is_described_enum<E>::value;
+
+namespace detail {
+template <class E> using enumerator_list_t = std::decay_t<decltype(static_type_enumerators_v<E>.value())>;
+
+template <class E> constexpr std::underlying_type_t<E> enumerator_value(std::size_t i) noexcept {
+    return static_cast<std::underlying_type_t<E>>(static_type_enumerators_v<E>.value()[i].value());
+}
+
+/// the minimal (`Less == true`) or the maximal value of the enumerators
+template <class E, bool Less> constexpr std::underlying_type_t<E> enumerator_bound() noexcept {
+    std::size_t result = 0;
+    for (std::size_t i = 1; i < enumerator_list_t<E>::size(); ++i) {
+        if (Less ? enumerator_value<E>(i) < enumerator_value<E>(result)
+                 : enumerator_value<E>(result) < enumerator_value<E>(i))
+            result = i;
+    }
+    return enumerator_list_t<E>::size() == 0 ? std::underlying_type_t<E>{} : enumerator_value<E>(result);
+}
+
+/// `value - min` without overflow, the value must not be less than `min`
+template <class U> constexpr std::uintmax_t enum_offset(U value, U min) noexcept {
+    return static_cast<std::uintmax_t>(value) - static_cast<std::uintmax_t>(min);
+}
+
+template <class E, std::size_t N, bool Dense>
+constexpr constexpr_array<std::size_t, N> make_enum_dense_table() noexcept {
+    constexpr_array<std::size_t, N> result{};
+    for (std::size_t i = 0; i < N; ++i)
+        result[i] = string_view::npos;
+    // the first name of the value is used, if there are aliases
+    for (std::size_t i = enumerator_list_t<E>::size(); Dense && i-- > 0;)
+        result[std::size_t(enum_offset(enumerator_value<E>(i), enumerator_bound<E, true>()))] = i;
+    return result;
+}
+
+template <class E, std::size_t N> constexpr constexpr_array<std::size_t, N> make_enum_sorted_table() noexcept {
+    constexpr_array<std::size_t, N> result{};
+    for (std::size_t i = 0; i < N; ++i) {
+        std::size_t j = i;
+        for (; j > 0 && enumerator_value<E>(i) < enumerator_value<E>(result[j - 1]); --j)
+            result[j] = result[j - 1];
+        result[j] = i;
+    }
+    return result;
+}
+
+template <class E, std::size_t N> constexpr constexpr_array<string_view, N> make_enum_names() noexcept {
+    constexpr_array<string_view, N> result{};
+    for (std::size_t i = 0; i < N; ++i)
+        result[i] = static_type_enumerators_v<E>.value()[i].name();
+    return result;
+}
+
+/// Lookup tables of the described enumeration.
+/// @details Values are mapped to enumerator indexes by a dense array indexed by `value - min` when the values are
+/// close to each other, otherwise by the binary search in the array of indexes sorted by values.
+/// Names are mapped to enumerator indexes by the perfect hash.
+template <class E> struct enum_index {
+    using underlying_type = std::underlying_type_t<E>;
+
+    static constexpr std::size_t npos       = string_view::npos;
+    static constexpr std::size_t size       = enumerator_list_t<E>::size();
+    static constexpr underlying_type min    = enumerator_bound<E, true>();
+    static constexpr underlying_type max    = enumerator_bound<E, false>();
+    static constexpr bool dense             = size != 0 && enum_offset(max, min) < 4 * size;
+    static constexpr std::size_t dense_size = dense ? std::size_t(enum_offset(max, min)) + 1 : 1;
+
+    static constexpr constexpr_array<std::size_t, dense_size> by_dense_value =
+        make_enum_dense_table<E, dense_size, dense>();
+    static constexpr constexpr_array<std::size_t, size> by_sorted_value = make_enum_sorted_table<E, size>();
+    static constexpr constexpr_array<string_view, size> names           = make_enum_names<E, size>();
+    static constexpr perfect_hash<size> by_name{names, 0};
+
+    /// @return index of the first enumerator with the value or `npos`
+    static constexpr std::size_t find(E e) noexcept {
+        const underlying_type value = static_cast<underlying_type>(e);
+        if (size == 0 || value < min || max < value)
+            return npos;
+        if (dense)
+            return by_dense_value[std::size_t(enum_offset(value, min))];
+        std::size_t first = 0;
+        std::size_t count = size;
+        while (count > 0) {
+            const std::size_t half = count / 2;
+            if (enumerator_value<E>(by_sorted_value[first + half]) < value) {
+                first += half + 1;
+                count -= half + 1;
+            } else {
+                count = half;
+            }
+        }
+        return first < size && enumerator_value<E>(by_sorted_value[first]) == value ? by_sorted_value[first] : npos;
+    }
+};
+template <class E> constexpr std::size_t enum_index<E>::npos;
+template <class E> constexpr std::size_t enum_index<E>::size;
+template <class E> constexpr typename enum_index<E>::underlying_type enum_index<E>::min;
+template <class E> constexpr typename enum_index<E>::underlying_type enum_index<E>::max;
+template <class E> constexpr bool enum_index<E>::dense;
+template <class E> constexpr std::size_t enum_index<E>::dense_size;
+template <class E>
+constexpr constexpr_array<std::size_t, enum_index<E>::dense_size> enum_index<E>::by_dense_value;
+template <class E> constexpr constexpr_array<std::size_t, enum_index<E>::size> enum_index<E>::by_sorted_value;
+template <class E> constexpr constexpr_array<string_view, enum_index<E>::size> enum_index<E>::names;
+template <class E> constexpr perfect_hash<enum_index<E>::size> enum_index<E>::by_name;
+} // namespace detail
+
+/** Returns the name of the enumerator with the value `e`.
+
+    @details
+    The enumeration must be described by `info_builder::enumerators`. If the values of the enumerators are
+    close to each other, the name is taken from a dense table indexed by the value, otherwise it is found by
+    the binary search in the sorted table of values.
+    @return enumerator name, or the empty string if the value has no name.
+    If several enumerators have the same value, the first described name is returned.
+ */
+template <class E, std::enable_if_t<is_described_enum<E>::value, bool> = true>
+constexpr zstring_view to_string(E e) noexcept {
+    const std::size_t index = detail::enum_index<E>::find(e);
+    return index == string_view::npos ? zstring_view{} : static_type_enumerators_v<E>.value()[index].name();
+}
+
+/** Converts the enumerator name to the value.
+
+    @details The name is found in O(1) by the compile-time perfect hash of the enumerator names.
+    @param name - enumerator name
+    @param value - the result, it is not changed if the name is not found
+    @return `true` if the name is found
+ */
+template <class E, std::enable_if_t<is_described_enum<E>::value, bool> = true>
+constexpr bool from_string(string_view name, E& value) noexcept {
+    const std::size_t index = detail::enum_index<E>::by_name.find(name);
+    if (index == string_view::npos)
+        return false;
+    value = static_type_enumerators_v<E>.value()[index].value();
+    return true;
+}
+
+} // namespace tmdesc
@@ -6,8 +6,8 @@
 // https://github.com/Ariox41/tmdesc
 
 #pragma once
+#include "algorithm/unpack.hpp"
 #include "type_info/get_type_info.hpp"
-#include <boost/hana/fwd/unpack.hpp>
 namespace tmdesc {
 namespace tags {
 struct foldable_struct_tag {};
@@ -19,24 +19,23 @@ namespace detail {
 template <class T, class Fn> struct unpack_foldable_struct_impl {
     T owner;
     Fn fn;
-    template <class... MI> constexpr auto operator()(const MI&... mi) const {
+    template <class... MI> constexpr decltype(auto) operator()(const MI&... mi) const {
         return static_cast<Fn&&>(fn)(mi.getter()(static_cast<T>(owner))...);
     }
 };
 } // namespace detail
-} // namespace tmdesc
 
-namespace boost {
-namespace hana {
-template <class T> struct tag_of<T, when<!is_nothing(::tmdesc::static_type_members_v<T>)>> {
+namespace meta {
+template <class T> struct tag_of<T, std::enable_if_t<!decltype(is_none(static_type_members_v<T>))::value>> {
     using type = ::tmdesc::tags::foldable_struct_tag;
 };
-template <> struct unpack_impl<::tmdesc::tags::foldable_struct_tag> {
-    template <typename Xs, typename F> static constexpr auto apply(Xs&& xs, F&& f) {
-        return unpack(
-            ::tmdesc::static_type_members_v<std::decay_t<Xs>>,
-            ::tmdesc::detail::unpack_foldable_struct_impl<Xs&&, F&&>{static_cast<Xs&&>(xs), static_cast<F&&>(f)});
+} // namespace meta
+
+/// `unpack` implementation for described struct: fn(member1, member2, ..., memberN)
+template <> struct unpack_impl<tags::foldable_struct_tag> {
+    template <typename Xs, typename F> static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+        return unpack(static_type_members_v<std::decay_t<Xs>>.value(),
+                      detail::unpack_foldable_struct_impl<Xs&&, F&&>{static_cast<Xs&&>(xs), static_cast<F&&>(f)});
     }
 };
-} // namespace hana
-} // namespace boost
+} // namespace tmdesc
@@ -0,0 +1,164 @@
+// Copyright Victor Smirnov 2021-2022
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+//
+// The documentation can be found at the library's page:
+// https://github.com/Ariox41/tmdesc
+
+#pragma once
+#include "../core/integral_constant.hpp"
+#include "../meta/logical_operations.hpp"
+#include "invoke.hpp"
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace tmdesc {
+namespace detail {
+/// Value `I` of a fold level, `T` is a reference for the arguments and for the reference results of the function
+template <std::size_t I, class T> struct fold_tree_value { T value; };
+
+/// Values of a fold level. Unlike `tuple`, the bases are aggregates without constructor templates,
+/// which matters for thousands of values.
+template <class Indices, class... Ts> struct fold_tree_values;
+template <std::size_t... Is, class... Ts>
+struct fold_tree_values<std::index_sequence<Is...>, Ts...> : fold_tree_value<Is, Ts>... {
+    constexpr explicit fold_tree_values(Ts&&... ts) noexcept(
+        meta::fast_values_and_v<std::is_nothrow_constructible<Ts, Ts&&>...>)
+      : fold_tree_value<Is, Ts>{static_cast<Ts&&>(ts)}... {}
+};
+
+template <class... Ts> using make_fold_tree_values = fold_tree_values<std::index_sequence_for<Ts...>, Ts...>;
+
+template <std::size_t I, class T> T fold_tree_value_type(const fold_tree_value<I, T>&) noexcept;
+
+/// Value `I` of the level `Values`.
+/// The type is deduced from the bases once for each value, it is linear in the count of values.
+template <std::size_t I, class Values> struct fold_tree_element {
+    using type = decltype(fold_tree_value_type<I>(std::declval<Values&>()));
+    using base = fold_tree_value<I, type>;
+};
+
+/// Reference to the value `I` of the level `Values`, the value is moved out of the level: each value is taken once.
+/// @note The access is a cast at the call site, a function template per value would put the level type into
+/// a symbol for each value, and the object code would be quadratic.
+template <std::size_t I, class Values> using fold_tree_take_t = typename fold_tree_element<I, Values>::type&&;
+template <std::size_t I, class Values> using fold_tree_base_t = typename fold_tree_element<I, Values>::base&;
+
+template <class Fn, class Values, std::size_t I>
+using fold_tree_pair_nothrow = is_nothrow_invocable<Fn&, typename fold_tree_element<2 * I, Values>::type,
+                                                    typename fold_tree_element<2 * I + 1, Values>::type>;
+
+template <class Fn, class Values, std::size_t I>
+using fold_tree_pair_result_t = invoke_result_t<Fn&, typename fold_tree_element<2 * I, Values>::type,
+                                                typename fold_tree_element<2 * I + 1, Values>::type>;
+
+/// Values of the next level: the results of adjacent pairs, and the last value of the odd count
+template <class Fn, class Values, class PairIndices, bool Odd> struct fold_tree_next;
+template <class Fn, class Values, std::size_t... Is>
+struct fold_tree_next<Fn, Values, std::index_sequence<Is...>, false> {
+    using type = make_fold_tree_values<fold_tree_pair_result_t<Fn, Values, Is>...>;
+
+    static constexpr bool nothrow = meta::fast_values_and_v<fold_tree_pair_nothrow<Fn, Values, Is>...>;
+
+    static constexpr type apply(Fn& fn, Values& values) noexcept(nothrow) {
+        return type{invoke(fn,
+                           static_cast<fold_tree_take_t<2 * Is, Values>>(
+                               static_cast<fold_tree_base_t<2 * Is, Values>>(values).value),
+                           static_cast<fold_tree_take_t<2 * Is + 1, Values>>(
+                               static_cast<fold_tree_base_t<2 * Is + 1, Values>>(values).value))...};
+    }
+};
+template <class Fn, class Values, std::size_t... Is>
+struct fold_tree_next<Fn, Values, std::index_sequence<Is...>, true> {
+    using last = fold_tree_element<sizeof...(Is) * 2, Values>;
+    using type = make_fold_tree_values<fold_tree_pair_result_t<Fn, Values, Is>..., typename last::type>;
+
+    static constexpr bool nothrow = meta::fast_values_and_v<fold_tree_pair_nothrow<Fn, Values, Is>...>;
+
+    static constexpr type apply(Fn& fn, Values& values) noexcept(nothrow) {
+        return type{invoke(fn,
+                           static_cast<fold_tree_take_t<2 * Is, Values>>(
+                               static_cast<fold_tree_base_t<2 * Is, Values>>(values).value),
+                           static_cast<fold_tree_take_t<2 * Is + 1, Values>>(
+                               static_cast<fold_tree_base_t<2 * Is + 1, Values>>(values).value))...,
+                    static_cast<fold_tree_take_t<sizeof...(Is) * 2, Values>>(
+                        static_cast<fold_tree_base_t<sizeof...(Is) * 2, Values>>(values).value)};
+    }
+};
+
+/// Fold of the level with `Count` values: adjacent pairs are folded to the next level,
+/// the last value of the odd count is carried over as is.
+/// The levels are nested calls, so the next level may refer to the values of the previous one.
+template <std::size_t Count, bool = (Count == 1)> struct fold_tree_level {
+    template <class Fn, class Values>
+    using next = fold_tree_next<Fn, std::decay_t<Values>, std::make_index_sequence<Count / 2>, (Count % 2 == 1)>;
+
+    template <class Fn, class Values>
+    using result_t = typename fold_tree_level<(Count + 1) / 2>::template result_t<Fn, typename next<Fn, Values>::type>;
+
+    template <class Fn, class Values>
+    static constexpr bool nothrow = next<Fn, Values>::nothrow &&
+        fold_tree_level<(Count + 1) / 2>::template nothrow<Fn, typename next<Fn, Values>::type>;
+
+    template <class Fn, class Values>
+    static constexpr result_t<Fn, Values> apply(Fn& fn, Values&& values) noexcept(nothrow<Fn, Values>) {
+        return fold_tree_level<(Count + 1) / 2>::apply(fn, next<Fn, Values>::apply(fn, values));
+    }
+};
+
+template <std::size_t Count> struct fold_tree_level<Count, true> {
+    template <class Fn, class Values> using result_t = typename fold_tree_element<0, std::decay_t<Values>>::type;
+
+    template <class Fn, class Values> static constexpr bool nothrow = true;
+
+    template <class Fn, class Values>
+    static constexpr result_t<Fn, Values> apply(Fn&, Values&& values) noexcept {
+        return static_cast<fold_tree_take_t<0, std::decay_t<Values>>>(
+            static_cast<fold_tree_base_t<0, std::decay_t<Values>>>(values).value);
+    }
+};
+} // namespace detail
+
+/// fold_tree(f, x1) => f(x1)
+/// fold_tree(f, x1, x2) => f(x1, x2)
+/// fold_tree(f, x1, x2, x3) => f(f(x1, x2), x3)
+/// fold_tree(f, x1, x2, x3, x4) => f(f(x1, x2), f(x3, x4))
+/// fold_tree(f, x1, ..., xn) => fold_tree(f, f(x1, x2), f(x3, x4), ..., f(xn-1, xn)), the last `x` of odd count
+/// is carried over as is.
+///
+/// @details
+/// The balanced fold for associative operations. Each level folds adjacent pairs of the previous level,
+/// so there are log2(N) nested instantiations instead of about N / 4 of @ref variadic_fold_left,
+/// and the packs of thousands of arguments do not reach the compiler limits.
+/// At runtime the pairs of a level are independent, e.g. the sum of floating point members is calculated with
+/// log2(N) dependent additions instead of N.
+///
+/// @note `f` must be associative, the result is the same as `variadic_fold_left` only in this case.
+/// As `variadic_fold_left`, the single argument is passed to `f`.
+/// @note `fn(args...)` is a `invoke(fn, args...)`
+#ifdef TMDESC_DOXYGEN
+constexpr auto fold_tree = [](auto&& fn, auto&& x1, auto&&... xs) -> decltype(auto) {};
+#else
+struct fold_tree_t {
+    template <class... As> using values_type = detail::make_fold_tree_values<As&&...>;
+
+    template <class Fn, class... As>
+    using result_t = typename detail::fold_tree_level<sizeof...(As)>::template result_t<Fn, values_type<As...>>;
+
+    template <class Fn, class A1>
+    constexpr auto operator()(Fn&& fn, A1&& a1) const noexcept(is_nothrow_invocable<Fn, A1>::value)
+        -> invoke_result_t<Fn, A1> {
+        return invoke(static_cast<Fn&&>(fn), static_cast<A1&&>(a1));
+    }
+    template <class Fn, class A1, class A2, class... As>
+    constexpr result_t<Fn, A1, A2, As...> operator()(Fn&& fn, A1&& a1, A2&& a2, As&&... as) const
+        noexcept(detail::fold_tree_level<sizeof...(As) + 2>::template nothrow<Fn, values_type<A1, A2, As...>>) {
+        return detail::fold_tree_level<sizeof...(As) + 2>::apply(
+            fn, values_type<A1, A2, As...>{static_cast<A1&&>(a1), static_cast<A2&&>(a2), static_cast<As&&>(as)...});
+    }
+};
+constexpr fold_tree_t fold_tree{};
+#endif
+
+} // namespace tmdesc
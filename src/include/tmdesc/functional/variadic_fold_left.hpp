@@ -10,8 +10,16 @@
 #include <utility>
 
 namespace tmdesc {
+namespace detail {
+/// `T`, which is dependent on `Dependency`: the name lookup in `T` is postponed to the instantiation
+template <class T, class Dependency> struct dependent_type { using type = T; };
+} // namespace detail
+
 struct variadic_fold_left_t {
     struct helper {
+        // the recursive overload is not visible in its own declaration, so it is called through the dependent type
+        template <class Fn> using self = typename detail::dependent_type<helper, Fn>::type;
+
         template <class Fn, class A1>
         static constexpr auto apply(Fn&& fn, A1&& a1) noexcept(noexcept(invoke(std::declval<Fn>(), std::declval<A1>())))
             -> decltype(invoke(std::declval<Fn>(), std::declval<A1>())) {
@@ -25,13 +33,16 @@ struct variadic_fold_left_t {
         }
         template <class Fn, class A1, class A2, class A3>
         static constexpr auto apply(Fn&& fn, A1&& a1, A2&& a2, A3&& a3)              //
-            noexcept(noexcept(invoke(invoke(std::declval<Fn>(),                      //
+            noexcept(noexcept(invoke(std::declval<Fn&>(),                            //
+                                     invoke(std::declval<Fn&>(),                     //
                                             std::declval<A1>(), std::declval<A2>()), //
                                      std::declval<A3>())))                           //
-            -> decltype(invoke(invoke(std::declval<Fn>(),                            //
+            -> decltype(invoke(std::declval<Fn&>(),                                  //
+                               invoke(std::declval<Fn&>(),                           //
                                       std::declval<A1>(), std::declval<A2>()),       //
                                std::declval<A3>())) {                                //
-            return invoke(invoke(std::forward<Fn>(fn),                               //
+            return invoke(fn,                                                        //
+                          invoke(fn,                                                 //
                                  std::forward<A1>(a1), std::forward<A2>(a2)),        //
                           std::forward<A3>(a3));                                     //
         }
@@ -84,20 +95,20 @@ struct variadic_fold_left_t {
                           std::forward<A5>(a5));                                                    //
         }
 
-        template <class Fn, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class... As>
+        template <class Fn, class A1, class A2, class A3, class A4, class A5, class A6, class... As>
         static constexpr auto apply(Fn&& fn, A1&& a1, A2&& a2, A3&& a3, A4&& a4, A5&& a5, A6&& a6, As&&... as) noexcept(
-            noexcept(helper::apply(std::declval<Fn&>(),
-                                   helper::apply(std::declval<Fn&>(), //
+            noexcept(self<Fn>::apply(std::declval<Fn&>(),
+                                   self<Fn>::apply(std::declval<Fn&>(), //
                                                  std::declval<A1>(), std::declval<A2>(), std::declval<A3>(),
                                                  std::declval<A4>(), std::declval<A5>()),
                                    std::declval<A6>(), std::declval<As>()...)))
-            -> decltype(helper::apply(std::declval<Fn&>(),
-                                      helper::apply(std::declval<Fn&>(), //
+            -> decltype(self<Fn>::apply(std::declval<Fn&>(),
+                                      self<Fn>::apply(std::declval<Fn&>(), //
                                                     std::declval<A1>(), std::declval<A2>(), std::declval<A3>(),
                                                     std::declval<A4>(), std::declval<A5>()),
                                       std::declval<A6>(), std::declval<As>()...)) {
-            return helper::apply(fn,
-                                 helper::apply(fn, //
+            return self<Fn>::apply(fn,
+                                 self<Fn>::apply(fn, //
                                                std::forward<A1>(a1), std::forward<A2>(a2), std::forward<A3>(a3),
                                                std::forward<A4>(a4), std::forward<A5>(a5)),
                                  std::forward<A6>(a6), std::forward<As>(as)...);
@@ -106,9 +117,9 @@ struct variadic_fold_left_t {
 
     template <class Fn, class A1, class... As>
     constexpr auto operator()(Fn&& fn, A1&& a1, As&&... as) const
-        noexcept(noexcept(helper::apply(std::forward<Fn>(fn), std::forward<A1>(a1))))
-            -> decltype(helper::apply(std::forward<Fn>(fn), std::forward<A1>(a1))) {
-        return helper::apply(std::forward<Fn>(fn), std::forward<A1>(a1));
+        noexcept(noexcept(helper::apply(std::declval<Fn>(), std::declval<A1>(), std::declval<As>()...)))
+            -> decltype(helper::apply(std::declval<Fn>(), std::declval<A1>(), std::declval<As>()...)) {
+        return helper::apply(std::forward<Fn>(fn), std::forward<A1>(a1), std::forward<As>(as)...);
     }
 };
 
@@ -118,6 +129,9 @@ struct variadic_fold_left_t {
 /// fold(f, x1, x2, ... xn) => f(f(...f(x1, x2)...), xn)
 ///
 /// @note `fn(args...)` is a `invoke(fn, args...)`
+/// @note The instantiation depth is linear: each nested instantiation folds 5 arguments into one,
+/// so there are about N / 4 nested instantiations for N arguments.
+/// Use @ref fold_tree for associative operations on large packs.
 constexpr variadic_fold_left_t variadic_fold_left;
 
 } // namespace tmdesc
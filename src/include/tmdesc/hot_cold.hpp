@@ -0,0 +1,244 @@
+// Copyright Victor Smirnov 2021-2022
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+//
+// The documentation can be found at the library's page:
+// https://github.com/Ariox41/tmdesc
+
+#pragma once
+#include "member_table.hpp"
+#include "type_info/detail/companion_info.hpp"
+#include "type_info/member_index.hpp"
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace tmdesc {
+template <class T> class hot_part;
+template <class T> class cold_part;
+template <class T, bool Const> class split_reference;
+
+namespace detail {
+/// the member `I` of `T` is marked by @ref tags::hot or @ref tags::hot_write
+template <class T, std::size_t I> struct is_hot_member {
+    using attribute_type = std::decay_t<decltype(at_c<I>(static_type_members_v<T>.value()).attributes())>;
+    static constexpr bool value =
+        has_key<attribute_type, tags::hot>::value || has_key<attribute_type, tags::hot_write>::value;
+};
+
+/// indexes of the hot (`Hot == true`) or cold members of `T`
+template <class T, bool Hot, class Indices, class Result = std::index_sequence<>> struct split_member_indices;
+template <class T, bool Hot, std::size_t... Rs>
+struct split_member_indices<T, Hot, std::index_sequence<>, std::index_sequence<Rs...>> {
+    using type = std::index_sequence<Rs...>;
+};
+template <class T, bool Hot, std::size_t I, std::size_t... Is, std::size_t... Rs>
+struct split_member_indices<T, Hot, std::index_sequence<I, Is...>, std::index_sequence<Rs...>>
+  : split_member_indices<T, Hot, std::index_sequence<Is...>,
+                         std::conditional_t<is_hot_member<T, I>::value == Hot, std::index_sequence<Rs..., I>,
+                                            std::index_sequence<Rs...>>> {};
+template <class T, bool Hot>
+using split_member_indices_t =
+    typename split_member_indices<T, Hot, std::make_index_sequence<members_count_v<T>>>::type;
+
+template <class T, std::size_t I> struct split_field {
+    using value_type = typename std::decay_t<decltype(at_c<I>(static_type_members_v<T>.value()))>::value_type;
+    value_type value{};
+};
+
+template <class T, class Indices> struct split_fields;
+template <class T, std::size_t... Is> struct split_fields<T, std::index_sequence<Is...>> : split_field<T, Is>... {
+    void load_into(T& out) const {
+        bool unused[] = {
+            true, (at_c<Is>(static_type_members_v<T>.value()).getter()(out) = split_field<T, Is>::value, true)...};
+        (void)unused;
+    }
+    void store_from(const T& in) {
+        bool unused[] = {
+            true, (split_field<T, Is>::value = at_c<Is>(static_type_members_v<T>.value()).getter()(in), true)...};
+        (void)unused;
+    }
+};
+
+template <class Part, class T, class Impl, std::size_t... Is>
+constexpr auto split_part_info(info_builder<Part, Impl> b, std::index_sequence<Is...>) {
+    return make_companion_type_info<T>(b, make_companion_member_info<Part, T, Is>(&split_field<T, Is>::value)...);
+}
+
+/// Getter of the member `I` of `T` from @ref split_reference, the member is in the hot or in the cold part
+template <class T, std::size_t I> struct split_getter {
+    template <class Reference> constexpr auto& operator()(const Reference& ref) const noexcept {
+        return get(ref, bool_constant<is_hot_member<T, I>::value>{});
+    }
+
+private:
+    template <class Reference> static constexpr auto& get(const Reference& ref, true_type) noexcept {
+        return static_cast<copy_const_t<decltype(ref.hot()), split_field<T, I>>&>(ref.hot()).value;
+    }
+    template <class Reference> static constexpr auto& get(const Reference& ref, false_type) noexcept {
+        return static_cast<copy_const_t<decltype(ref.cold()), split_field<T, I>>&>(ref.cold()).value;
+    }
+    template <class From, class To>
+    using copy_const_t = std::conditional_t<std::is_const<std::remove_reference_t<From>>::value, const To, To>;
+};
+
+template <class T, bool Const, class Impl, std::size_t... Is>
+constexpr auto split_reference_info(info_builder<split_reference<T, Const>, Impl> b, std::index_sequence<Is...>) {
+    return make_companion_type_info<T>(
+        b, make_companion_getter_info<typename split_field<T, Is>::value_type, T, Is>(split_getter<T, Is>{})...);
+}
+} // namespace detail
+
+/** The hot members of the described type `T`: the members marked by @ref tags::hot or @ref tags::hot_write.
+
+    @details
+    The part is described with the member names and attributes of `T`, so it is used with @ref members_view
+    and @ref get_member like `T`. See @ref split_vector for the container of the split objects.
+ */
+template <class T> class hot_part : public detail::split_fields<T, detail::split_member_indices_t<T, true>> {
+    static_assert(detail::has_static_members<T>::value, "the type has no members description");
+
+public:
+    using value_type = T;
+
+    hot_part() = default;
+    explicit hot_part(const T& value) { this->store_from(value); }
+
+    /// Copies the hot members of `value`
+    void assign(const T& value) { this->store_from(value); }
+    /// Copies the hot members to `out`, other members of `out` are not changed
+    void copy_to(T& out) const { this->load_into(out); }
+
+    template <class Impl> friend constexpr auto tmdesc_info(info_builder<hot_part, Impl> b) {
+        return detail::split_part_info<hot_part, T>(b, detail::split_member_indices_t<T, true>{});
+    }
+};
+
+/// The cold members of the described type `T`: the members which are not in the @ref hot_part.
+template <class T> class cold_part : public detail::split_fields<T, detail::split_member_indices_t<T, false>> {
+    static_assert(detail::has_static_members<T>::value, "the type has no members description");
+
+public:
+    using value_type = T;
+
+    cold_part() = default;
+    explicit cold_part(const T& value) { this->store_from(value); }
+
+    /// Copies the cold members of `value`
+    void assign(const T& value) { this->store_from(value); }
+    /// Copies the cold members to `out`, other members of `out` are not changed
+    void copy_to(T& out) const { this->load_into(out); }
+
+    template <class Impl> friend constexpr auto tmdesc_info(info_builder<cold_part, Impl> b) {
+        return detail::split_part_info<cold_part, T>(b, detail::split_member_indices_t<T, false>{});
+    }
+};
+
+/** The reference to the object of the type `T` split into the @ref hot_part and the @ref cold_part.
+
+    @details
+    The reference is described with all members of `T`, each member is accessed in its part,
+    so it is used with @ref members_view and @ref get_member like `T`. The reference has the pointer semantics:
+    the constness of the members depends on `Const`, not on the constness of the reference.
+ */
+template <class T, bool Const> class split_reference {
+public:
+    using value_type = T;
+    using hot_type   = std::conditional_t<Const, const hot_part<T>, hot_part<T>>;
+    using cold_type  = std::conditional_t<Const, const cold_part<T>, cold_part<T>>;
+
+    constexpr split_reference(hot_type& hot, cold_type& cold) noexcept
+      : hot_(&hot)
+      , cold_(&cold) {}
+
+    constexpr hot_type& hot() const noexcept { return *hot_; }
+    constexpr cold_type& cold() const noexcept { return *cold_; }
+
+    /// @return the copy of the referenced object
+    T get() const {
+        T result{};
+        hot_->copy_to(result);
+        cold_->copy_to(result);
+        return result;
+    }
+
+    /// Replaces the referenced object
+    template <bool C = Const, std::enable_if_t<!C, bool> = true> void set(const T& value) const {
+        hot_->assign(value);
+        cold_->assign(value);
+    }
+
+    template <class Impl> friend constexpr auto tmdesc_info(info_builder<split_reference, Impl> b) {
+        return detail::split_reference_info(b, std::make_index_sequence<detail::members_count_v<T>>{});
+    }
+
+private:
+    hot_type* hot_;
+    cold_type* cold_;
+};
+
+/** Sequence of objects of the described type `T`, the hot parts and the cold parts of the objects are stored
+    in separate arrays.
+
+    @details
+    The loops over the hot members touch only the hot array, so the cold members do not pollute the cache:
+    @code
+    tmdesc::split_vector<order> orders;
+    orders.push_back(o);
+    for (const auto& hot : orders.hot_parts())
+        total += tmdesc::get_member<TMDESC_NAME("quantity")>(hot);
+    orders[0].set(o);                                                  // split_reference<order, false>
+    tmdesc::for_each(tmdesc::members_view(orders[0]), print_member{}); // all members, hot and cold
+    @endcode
+ */
+template <class T> class split_vector {
+public:
+    using value_type      = T;
+    using reference       = split_reference<T, false>;
+    using const_reference = split_reference<T, true>;
+
+    std::size_t size() const noexcept { return hot_.size(); }
+    bool empty() const noexcept { return hot_.empty(); }
+
+    void reserve(std::size_t count) {
+        hot_.reserve(count);
+        cold_.reserve(count);
+    }
+    void clear() noexcept {
+        hot_.clear();
+        cold_.clear();
+    }
+
+    /// @note If the copy of the cold part throws, the hot part is removed, so the parts stay paired
+    void push_back(const T& value) {
+        hot_.emplace_back(value);
+        try {
+            cold_.emplace_back(value);
+        } catch (...) {
+            hot_.pop_back();
+            throw;
+        }
+    }
+    void pop_back() {
+        hot_.pop_back();
+        cold_.pop_back();
+    }
+
+    reference operator[](std::size_t i) noexcept { return {hot_[i], cold_[i]}; }
+    const_reference operator[](std::size_t i) const noexcept { return {hot_[i], cold_[i]}; }
+
+    /// @return the contiguous array of the hot parts, the size of the array must not be changed
+    std::vector<hot_part<T>>& hot_parts() noexcept { return hot_; }
+    const std::vector<hot_part<T>>& hot_parts() const noexcept { return hot_; }
+
+    /// @return the contiguous array of the cold parts, the size of the array must not be changed
+    std::vector<cold_part<T>>& cold_parts() noexcept { return cold_; }
+    const std::vector<cold_part<T>>& cold_parts() const noexcept { return cold_; }
+
+private:
+    std::vector<hot_part<T>> hot_;
+    std::vector<cold_part<T>> cold_;
+};
+
+} // namespace tmdesc
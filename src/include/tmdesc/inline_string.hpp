@@ -0,0 +1,161 @@
+// Copyright Victor Smirnov 2021-2022
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+//
+// The documentation can be found at the library's page:
+// https://github.com/Ariox41/tmdesc
+
+#pragma once
+#include "small_vector.hpp"
+#include "string_view.hpp"
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <utility>
+
+namespace tmdesc {
+
+/** String which stores up to `N` characters inside the object, the longer strings are moved to the heap.
+
+    @details
+    The string is null-terminated and is implicitly converted to @ref string_view, so it is compared with
+    @ref string_view, `std::string` and string literals. Decoders and @ref random_fill fill it like `std::string`,
+    so the member of this type is decoded without allocation if the length does not exceed `N`:
+    @code
+    struct order {
+        tmdesc::inline_string<15> symbol;
+
+        template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<order, Impl> b) {
+            return b.type(b.members(b.member("symbol", &order::symbol, b.attributes(b.max_size(15)))));
+        }
+    };
+    @endcode
+    The @ref tags::max_size attribute makes the decoders reject the longer strings, see @ref check_max_sizes.
+ */
+template <std::size_t N> class inline_string {
+public:
+    using value_type     = char;
+    using size_type      = std::size_t;
+    using iterator       = char*;
+    using const_iterator = const char*;
+
+    /// count of characters stored inside the object, without the null terminator
+    static constexpr std::size_t inline_capacity = N;
+
+    inline_string() noexcept { chars_.push_back('\0'); }
+    inline_string(const char* str, std::size_t size)
+      : inline_string() {
+        append(str, size);
+    }
+    /// @note implicit constructor, like std::string
+    inline_string(const char* cstr)
+      : inline_string(string_view(cstr)) {}
+    /// @note implicit constructor, like std::string
+    inline_string(string_view str)
+      : inline_string(str.data(), str.size()) {}
+    /// @note implicit constructor, like std::string
+    inline_string(const std::string& str)
+      : inline_string(str.data(), str.size()) {}
+    inline_string(const inline_string&) = default;
+    /// @note The source becomes empty and stays null-terminated
+    inline_string(inline_string&& other) noexcept
+      : chars_(std::move(other.chars_)) {
+        other.chars_.push_back('\0');
+    }
+
+    inline_string& operator=(const inline_string&) = default;
+    inline_string& operator=(inline_string&& other) noexcept {
+        if (this != &other) {
+            chars_ = std::move(other.chars_);
+            other.chars_.push_back('\0');
+        }
+        return *this;
+    }
+
+    operator string_view() const noexcept { return {data(), size()}; }
+    /// @return the copy of the string
+    std::string str() const { return {data(), size()}; }
+
+    std::size_t size() const noexcept { return chars_.size() - 1; }
+    std::size_t length() const noexcept { return size(); }
+    std::size_t capacity() const noexcept { return chars_.capacity() - 1; }
+    bool empty() const noexcept { return size() == 0; }
+    /// @return `true` if the characters are stored inside the object
+    bool is_inline() const noexcept { return chars_.is_inline(); }
+
+    char* data() noexcept { return chars_.data(); }
+    const char* data() const noexcept { return chars_.data(); }
+    const char* c_str() const noexcept { return chars_.data(); }
+    iterator begin() noexcept { return data(); }
+    const_iterator begin() const noexcept { return data(); }
+    iterator end() noexcept { return data() + size(); }
+    const_iterator end() const noexcept { return data() + size(); }
+
+    char& operator[](std::size_t i) noexcept { return chars_[i]; }
+    const char& operator[](std::size_t i) const noexcept { return chars_[i]; }
+
+    /// Moves the characters to the heap if `count` exceeds the capacity
+    void reserve(std::size_t count) { chars_.reserve(count + 1); }
+    void clear() noexcept { resize(0); }
+    /// Removes the last characters or appends copies of `c`
+    void resize(std::size_t count, char c = '\0') {
+        const std::size_t old_size = size();
+        chars_.resize(count + 1, c);
+        if (count > old_size)
+            chars_[old_size] = c;
+        chars_[count] = '\0';
+    }
+    void push_back(char c) {
+        chars_.back() = c;
+        chars_.push_back('\0');
+    }
+    void pop_back() noexcept {
+        chars_.pop_back();
+        chars_.back() = '\0';
+    }
+
+    /// Replaces the characters, `str` may refer to this string
+    inline_string& assign(const char* str, std::size_t size) {
+        if (overlaps(str))
+            return *this = inline_string(str, size);
+        clear();
+        return append(str, size);
+    }
+    inline_string& assign(string_view str) { return assign(str.data(), str.size()); }
+
+    /// Appends the characters, `str` may refer to this string
+    inline_string& append(const char* str, std::size_t size) {
+        if (size == 0)
+            return *this;
+        if (overlaps(str))
+            return append(inline_string(str, size));
+        const std::size_t old_size = this->size();
+        chars_.resize(old_size + size + 1);
+        std::memcpy(chars_.data() + old_size, str, size);
+        return *this;
+    }
+    inline_string& append(string_view str) { return append(str.data(), str.size()); }
+    inline_string& operator+=(string_view str) { return append(str); }
+    inline_string& operator+=(char c) {
+        push_back(c);
+        return *this;
+    }
+
+private:
+    bool overlaps(const char* str) const noexcept {
+        return std::less_equal<const char*>()(chars_.data(), str) &&
+               std::less<const char*>()(str, chars_.data() + chars_.size());
+    }
+
+    /// the characters and the null terminator
+    small_vector<char, N + 1> chars_;
+};
+template <std::size_t N> constexpr std::size_t inline_string<N>::inline_capacity;
+
+namespace detail {
+template <class T> struct is_inline_string : false_type {};
+template <std::size_t N> struct is_inline_string<inline_string<N>> : true_type {};
+} // namespace detail
+
+} // namespace tmdesc
@@ -0,0 +1,194 @@
+// Copyright Victor Smirnov 2021-2022
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+//
+// The documentation can be found at the library's page:
+// https://github.com/Ariox41/tmdesc
+
+#pragma once
+#include "member_table.hpp"
+#include "string_view.hpp"
+#include "type_info/get_type_info.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define TMDESC_HAS_RDTSC 1
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define TMDESC_HAS_RDTSC 1
+#endif
+
+namespace tmdesc {
+
+/// Counters of the instrumented calls for the type, see @ref instrumentation_snapshot.
+struct instrumentation_counters {
+    /// identifier of the type
+    type_id type;
+    /// the value of @ref tags::type_name attribute of the type, or the empty string
+    zstring_view type_name;
+    /// count of the instrumented calls
+    std::uint64_t calls;
+    /// count of bytes reported by the calls, see `scope::add_bytes`
+    std::uint64_t bytes;
+    /// sum of the call durations in the cycles of the time stamp counter,
+    /// or in nanoseconds if the time stamp counter is not available
+    std::uint64_t cycles;
+};
+
+/** Instrumentation policy which does nothing, the default policy of the instrumented algorithms.
+
+    @details
+    The policy defines the `scope<T>` class, created for each instrumented call with the processed type `T`.
+    The scope of this policy is empty and has no side effects, so it is completely removed by the compiler.
+ */
+struct no_instrumentation {
+    template <class T> class scope {
+    public:
+        /// reports the count of produced bytes
+        void add_bytes(std::size_t) noexcept {}
+    };
+};
+
+namespace detail {
+inline std::uint64_t read_cycle_counter() noexcept {
+#ifdef TMDESC_HAS_RDTSC
+    return __rdtsc();
+#else
+    return std::uint64_t(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+#endif
+}
+
+template <class T, class = void> struct instrumented_type_name {
+    static constexpr zstring_view get() noexcept { return {}; }
+};
+template <class T>
+struct instrumented_type_name<
+    T, std::enable_if_t<has_key<decltype(static_type_attributes_v<T>.value()), tags::type_name>::value>> {
+    static constexpr zstring_view get() noexcept {
+        return at_key(static_type_attributes_v<T>.value(), type_c<tags::type_name>);
+    }
+};
+
+/// Counters of the type in a single thread.
+/// The counters are written only by the owner thread, so relaxed loads and stores are enough.
+struct instrumentation_block {
+    type_id type;
+    zstring_view type_name;
+    std::atomic<std::uint64_t> calls{0};
+    std::atomic<std::uint64_t> bytes{0};
+    std::atomic<std::uint64_t> cycles{0};
+
+    static void add(std::atomic<std::uint64_t>& counter, std::uint64_t value) noexcept {
+        counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+    instrumentation_counters load() const noexcept {
+        return {type, type_name, calls.load(std::memory_order_relaxed), bytes.load(std::memory_order_relaxed),
+                cycles.load(std::memory_order_relaxed)};
+    }
+};
+
+/// Blocks of all running threads and the counters of finished threads
+class instrumentation_registry {
+public:
+    static instrumentation_registry& instance() {
+        static instrumentation_registry registry;
+        return registry;
+    }
+
+    void add(instrumentation_block* block) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        live_.push_back(block);
+    }
+
+    void retire(instrumentation_block* block) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        live_.erase(std::remove(live_.begin(), live_.end(), block), live_.end());
+        merge(retired_, block->load());
+    }
+
+    std::vector<instrumentation_counters> snapshot() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::vector<instrumentation_counters> result = retired_;
+        for (const instrumentation_block* block : live_)
+            merge(result, block->load());
+        return result;
+    }
+
+private:
+    static void merge(std::vector<instrumentation_counters>& counters, const instrumentation_counters& value) {
+        for (auto& c : counters) {
+            if (c.type == value.type) {
+                c.calls += value.calls;
+                c.bytes += value.bytes;
+                c.cycles += value.cycles;
+                return;
+            }
+        }
+        counters.push_back(value);
+    }
+
+    std::mutex mutex_;
+    std::vector<instrumentation_block*> live_;
+    std::vector<instrumentation_counters> retired_;
+};
+
+template <class T> struct thread_instrumentation_block : instrumentation_block {
+    thread_instrumentation_block() {
+        type      = type_id_v<T>;
+        type_name = instrumented_type_name<T>::get();
+        instrumentation_registry::instance().add(this);
+    }
+    ~thread_instrumentation_block() { instrumentation_registry::instance().retire(this); }
+};
+
+template <class T> instrumentation_block& thread_instrumentation() {
+    static thread_local thread_instrumentation_block<T> block;
+    return block;
+}
+} // namespace detail
+
+/** Instrumentation policy which counts the calls, the produced bytes and the duration of the calls for each type.
+
+    @details
+    The counters are thread-local, so the instrumented call does not synchronize with other threads.
+    The counters of all threads are collected by @ref instrumentation_snapshot.
+ */
+struct counting_instrumentation {
+    template <class T> class scope {
+    public:
+        /// @note The first scope of `T` in a thread registers the counters of the thread, it may throw `bad_alloc`
+        scope()
+          : block_(detail::thread_instrumentation<T>())
+          , start_(detail::read_cycle_counter()) {}
+        scope(const scope&) = delete;
+        scope& operator=(const scope&) = delete;
+        ~scope() {
+            detail::instrumentation_block::add(block_.calls, 1);
+            detail::instrumentation_block::add(block_.cycles, detail::read_cycle_counter() - start_);
+        }
+
+        /// reports the count of produced bytes
+        void add_bytes(std::size_t count) noexcept { detail::instrumentation_block::add(block_.bytes, count); }
+
+    private:
+        detail::instrumentation_block& block_;
+        std::uint64_t start_;
+    };
+};
+
+/// @return the counters of all types instrumented by @ref counting_instrumentation, summed over all threads
+inline std::vector<instrumentation_counters> instrumentation_snapshot() {
+    return detail::instrumentation_registry::instance().snapshot();
+}
+
+} // namespace tmdesc
@@ -0,0 +1,122 @@
+// Copyright Victor Smirnov 2021-2022
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+//
+// The documentation can be found at the library's page:
+// https://github.com/Ariox41/tmdesc
+
+#pragma once
+#include "algorithm/for_each.hpp"
+#include "borrowed.hpp"
+#include "inline_string.hpp"
+#include "member_table.hpp"
+#include "members_view.hpp"
+#include "small_vector.hpp"
+#include <cstddef>
+#include <type_traits>
+
+namespace tmdesc {
+
+/// Value of @ref max_size_v for the members without the @ref tags::max_size attribute
+constexpr std::size_t unlimited_size = std::size_t(-1);
+
+namespace detail {
+template <class AS, bool = has_key<AS, tags::max_size>::value> struct max_size_of {
+    static constexpr std::size_t get(const AS&) noexcept { return unlimited_size; }
+};
+template <class AS> struct max_size_of<AS, true> {
+    static constexpr std::size_t get(const AS& attributes) noexcept {
+        return at_key(attributes, type_c<tags::max_size>);
+    }
+};
+
+/// strings and sequences which may have the @ref tags::max_size attribute, borrowed members are checked too
+template <class T>
+using is_sized_member = bool_constant<is_std_string<T>::value || is_inline_string<T>::value ||
+                                      is_borrowed_string<T>::value || is_std_vector<T>::value ||
+                                      is_small_vector<T>::value>;
+
+template <class T>
+using is_sequence_member = bool_constant<is_std_vector<T>::value || is_small_vector<T>::value ||
+                                         is_fixed_array<T>::value>;
+
+template <class T, std::size_t I> struct member_max_size {
+    using attribute_type = std::decay_t<decltype(at_c<I>(static_type_members_v<T>.value()).attributes())>;
+    static constexpr std::size_t value =
+        max_size_of<attribute_type>::get(at_c<I>(static_type_members_v<T>.value()).attributes());
+};
+template <class T, std::size_t I> constexpr std::size_t member_max_size<T, I>::value;
+} // namespace detail
+
+/// The value of @ref tags::max_size attribute of the member `I` of `T`, or @ref unlimited_size
+template <class T, std::size_t I> constexpr std::size_t max_size_v = detail::member_max_size<T, I>::value;
+
+namespace detail {
+struct max_sizes_checker {
+    bool ok = true;
+
+    template <class T> void operator()(const T& value) {
+        check(value, bool_constant<has_static_members<T>::value>{}, is_sequence_member<T>{});
+    }
+    template <class T> void check(const T& value, true_type, false_type) {
+        for_each(members_view(value), member_checker{*this});
+    }
+    template <class T> void check(const T& value, false_type, true_type) {
+        for (const auto& item : value)
+            (*this)(item);
+    }
+    template <class T> void check(const T&, false_type, false_type) {}
+
+    struct member_checker {
+        max_sizes_checker& checker;
+        template <class M> void operator()(M member) const {
+            using attribute_type = std::decay_t<decltype(member.attributes())>;
+            check_size(member.get(), max_size_of<attribute_type>::get(member.attributes()),
+                       bool_constant<is_sized_member<typename M::value_type>::value ||
+                                     is_borrowed_member_v<std::decay_t<decltype(member.info())>>>{});
+            checker(member.get());
+        }
+        template <class V> void check_size(const V& value, std::size_t max_size, true_type) const {
+            checker.ok = checker.ok && value.size() <= max_size;
+        }
+        template <class V> void check_size(const V&, std::size_t, false_type) const {}
+    };
+};
+} // namespace detail
+
+/** Checks the sizes of the string, container and borrowed members with the @ref tags::max_size attribute,
+    recursively.
+
+    @details
+    The members of the described type are checked, then the nested described types and the elements of
+    `std::vector`, @ref small_vector and arrays. The pointers are not followed.
+    The decoders check the same limits before reading the values, this function checks the values built by
+    other code before encoding them:
+    @code
+    struct order {
+        tmdesc::inline_string<15> symbol;
+        tmdesc::small_vector<fill, 4> fills;
+
+        template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<order, Impl> b) {
+            return b.type(b.members(b.member("symbol", &order::symbol, b.attributes(b.max_size(15))),
+                                    b.member("fills", &order::fills, b.attributes(b.max_size(16)))));
+        }
+    };
+    bool valid = tmdesc::check_max_sizes(o);
+    @endcode
+    @return `true` if each member size does not exceed its limit
+ */
+#ifdef TMDESC_DOXYGEN
+constexpr auto check_max_sizes = [](const auto& value) -> bool {};
+#else
+struct check_max_sizes_t {
+    template <class T> bool operator()(const T& value) const {
+        detail::max_sizes_checker checker;
+        checker(value);
+        return checker.ok;
+    }
+};
+constexpr check_max_sizes_t check_max_sizes{};
+#endif
+
+} // namespace tmdesc
@@ -0,0 +1,95 @@
+// Copyright Victor Smirnov 2021-2022
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+//
+// The documentation can be found at the library's page:
+// https://github.com/Ariox41/tmdesc
+
+#pragma once
+#include "string_view.hpp"
+#include "type_info/member_index.hpp"
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace tmdesc {
+
+/// Compile-time member name, the type is usually created by @ref TMDESC_NAME.
+template <char... Cs> struct member_name {
+    static constexpr char c_str[sizeof...(Cs) + 1] = {Cs..., '\0'};
+
+    static constexpr zstring_view value() noexcept { return c_str; }
+};
+template <char... Cs> constexpr char member_name<Cs...>::c_str[sizeof...(Cs) + 1];
+
+namespace detail {
+/// the maximal length of the name literal in @ref TMDESC_NAME
+constexpr std::size_t max_member_name_size = 64;
+
+template <std::size_t N> constexpr char name_literal_char(const char (&str)[N], std::size_t i) noexcept {
+    return i < N ? str[i] : '\0';
+}
+
+template <char... Cs> constexpr char name_pack_char(std::size_t i) noexcept {
+    constexpr char chars[] = {Cs...};
+    return chars[i];
+}
+
+template <class Indices, char... Cs> struct make_member_name_impl;
+template <std::size_t... Is, char... Cs> struct make_member_name_impl<std::index_sequence<Is...>, Cs...> {
+    using type = member_name<name_pack_char<Cs...>(Is)...>;
+};
+
+/// drops the padding of the name literal
+template <std::size_t Size, char... Cs> struct make_member_name {
+    static_assert(Size <= max_member_name_size, "the name literal is too long for TMDESC_NAME");
+    using type = typename make_member_name_impl<std::make_index_sequence<Size>, Cs...>::type;
+};
+} // namespace detail
+
+#define TMDESC_DETAIL_NAME_CHAR(str, i) ::tmdesc::detail::name_literal_char(str, i)
+#define TMDESC_DETAIL_NAME_CHARS_4(str, i)                                                                             \
+    TMDESC_DETAIL_NAME_CHAR(str, i), TMDESC_DETAIL_NAME_CHAR(str, i + 1), TMDESC_DETAIL_NAME_CHAR(str, i + 2),         \
+        TMDESC_DETAIL_NAME_CHAR(str, i + 3)
+#define TMDESC_DETAIL_NAME_CHARS_16(str, i)                                                                            \
+    TMDESC_DETAIL_NAME_CHARS_4(str, i), TMDESC_DETAIL_NAME_CHARS_4(str, i + 4),                                        \
+        TMDESC_DETAIL_NAME_CHARS_4(str, i + 8), TMDESC_DETAIL_NAME_CHARS_4(str, i + 12)
+#define TMDESC_DETAIL_NAME_CHARS_64(str)                                                                               \
+    TMDESC_DETAIL_NAME_CHARS_16(str, 0), TMDESC_DETAIL_NAME_CHARS_16(str, 16),                                         \
+        TMDESC_DETAIL_NAME_CHARS_16(str, 32), TMDESC_DETAIL_NAME_CHARS_16(str, 48)
+
+/** The type @ref member_name for the string literal, `TMDESC_NAME("port")` is `member_name<'p', 'o', 'r', 't'>`.
+
+    @details
+    C++14 has no string literals as template arguments, so the literal is split into characters by the macro.
+    The literal length is limited by 64 characters.
+    @code
+    using port = TMDESC_NAME("port");
+    tmdesc::get_member<port>(cfg) = 8080;
+    @endcode
+ */
+#define TMDESC_NAME(str)                                                                                               \
+    typename ::tmdesc::detail::make_member_name<sizeof(str) - 1, TMDESC_DETAIL_NAME_CHARS_64(str)>::type
+
+/// Index of the member with the name `Name` in the description of the type `T`, or `string_view::npos`.
+/// @details The index is found by the compile-time perfect hash of member names, see @ref find_member_index.
+template <class T, class Name> constexpr std::size_t member_index_v = find_member_index<T>(Name::value());
+
+/** Returns the reference to the member of `owner` with the name `Name`.
+
+    @details
+    The member index is resolved at compile time, so the call is a direct member access:
+    `get_member<TMDESC_NAME("port")>(cfg)` is the same as `cfg.port`.
+    The member reference qualifiers depend on the `owner` qualifiers.
+    @tparam Name - @ref member_name, see @ref TMDESC_NAME
+    @note The program is ill-formed if the type has no member with the name.
+ */
+template <class Name, class Owner> constexpr decltype(auto) get_member(Owner&& owner) noexcept {
+    using owner_type            = std::decay_t<Owner>;
+    constexpr std::size_t index = member_index_v<owner_type, Name>;
+    static_assert(index != string_view::npos, "the type has no member with the name");
+    return at_c<(index == string_view::npos ? 0 : index)>(static_type_members_v<owner_type>.value())
+        .getter()(static_cast<Owner&&>(owner));
+}
+
+} // namespace tmdesc
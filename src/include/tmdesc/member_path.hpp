@@ -0,0 +1,93 @@
+// Copyright Victor Smirnov 2021-2022
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+//
+// The documentation can be found at the library's page:
+// https://github.com/Ariox41/tmdesc
+
+#pragma once
+#include "member_table.hpp"
+#include "string_view.hpp"
+#include <cstddef>
+
+namespace tmdesc {
+
+/** Resolved dotted path to a nested member of the described type `T`, see @ref path.
+
+    @details
+    The path stores the total byte offset of the leaf member and its descriptor,
+    so the access is a single pointer addition without name lookups.
+    An unresolved path is empty: `valid()` is false and all accessors return `nullptr`.
+ */
+template <class T> class member_path {
+public:
+    constexpr member_path() noexcept = default;
+    constexpr member_path(std::size_t offset, const member_descriptor* leaf) noexcept
+      : offset_(offset)
+      , leaf_(leaf) {}
+
+    constexpr bool valid() const noexcept { return leaf_ != nullptr; }
+    constexpr explicit operator bool() const noexcept { return valid(); }
+
+    /// byte offset of the leaf member inside the `T` object
+    constexpr std::size_t offset() const noexcept { return offset_; }
+
+    /// descriptor of the leaf member or `nullptr`
+    constexpr const member_descriptor* leaf() const noexcept { return leaf_; }
+
+    /// @return address of the leaf member inside the `owner` object or `nullptr`
+    void* address(T& owner) const noexcept {
+        return valid() ? reinterpret_cast<char*>(&owner) + offset_ : nullptr;
+    }
+    /// @return address of the leaf member inside the `owner` object or `nullptr`
+    const void* address(const T& owner) const noexcept {
+        return valid() ? reinterpret_cast<const char*>(&owner) + offset_ : nullptr;
+    }
+
+    /// @return pointer to the leaf member if the path is valid and the member type is `M`, `nullptr` otherwise
+    template <class M> M* get_if(T& owner) const noexcept {
+        return valid() && leaf_->is<M>() ? static_cast<M*>(address(owner)) : nullptr;
+    }
+    /// @return pointer to the leaf member if the path is valid and the member type is `M`, `nullptr` otherwise
+    template <class M> const M* get_if(const T& owner) const noexcept {
+        return valid() && leaf_->is<M>() ? static_cast<const M*>(address(owner)) : nullptr;
+    }
+
+private:
+    std::size_t offset_             = 0;
+    const member_descriptor* leaf_ = nullptr;
+};
+
+/** Resolves the dotted path like `"a.b.c"` to the nested member of the described type `T`.
+
+    @details
+    Each segment is found by the perfect hash of member names of the current type,
+    all segments except the last one must name members of described types.
+    The resolution is done once, the result is reused for any number of objects:
+    @code
+    static const auto port = tmdesc::path<config>("server.listen.port");
+    if (auto* p = port.get_if<int>(cfg))
+        *p = 8080;
+    @endcode
+    @return resolved path, or empty path if some segment is not found
+    @note Member offsets are not constant expressions in C++14, so the path is resolved at runtime.
+ */
+template <class T> member_path<T> path(string_view dotted) noexcept {
+    const member_table* table = &member_table_of<T>();
+    std::size_t offset        = 0;
+    for (;;) {
+        const std::size_t dot         = dotted.find_first_of('.');
+        const member_descriptor* leaf = table->find(dotted.substr(0, dot));
+        if (leaf == nullptr)
+            return {};
+        offset += leaf->offset;
+        if (dot == string_view::npos)
+            return {offset, leaf};
+        if (leaf->nested == nullptr)
+            return {};
+        table  = leaf->nested;
+        dotted = dotted.suffix(dotted.size() - dot - 1);
+    }
+}
+
+} // namespace tmdesc
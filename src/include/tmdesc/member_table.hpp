@@ -0,0 +1,215 @@
+// Copyright Victor Smirnov 2021-2022
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+//
+// The documentation can be found at the library's page:
+// https://github.com/Ariox41/tmdesc
+
+#pragma once
+#include "algorithm/unpack.hpp"
+#include "core/integral_constant.hpp"
+#include "enum_string.hpp"
+#include "string_view.hpp"
+#include "type_info/get_type_info.hpp"
+#include "type_info/member_index.hpp"
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace tmdesc {
+
+/// Kind of the member type.
+/// Runtime-generic code uses it together with @ref member_descriptor::size to interpret the member bytes.
+enum class member_kind : unsigned char {
+    other,            ///< any type not listed below
+    boolean,          ///< bool
+    signed_integer,   ///< signed integral type except bool
+    unsigned_integer, ///< unsigned integral type except bool
+    floating_point,   ///< floating point type
+    enumeration,      ///< enum or enum class
+    string,           ///< std::basic_string<char, ...>
+    string_view,      ///< @ref string_view or @ref zstring_view
+    described,        ///< type with a members description, see @ref member_descriptor::nested
+};
+
+struct member_table;
+
+/// Runtime conversions of the described enumeration, see @ref to_string and @ref from_string.
+struct enum_table {
+    /// enumerators count
+    std::size_t size;
+    /// @return name of the enumeration value at the address, or the empty string if the value has no name
+    zstring_view (*to_string)(const void* value) noexcept;
+    /// writes the value of the enumerator with the given name to the address
+    /// @return `false` if the name is not found
+    bool (*from_string)(string_view name, void* value) noexcept;
+};
+
+/// Identifier of a type without RTTI, see @ref type_id_v.
+using type_id = const void*;
+
+namespace detail {
+template <class T> struct type_id_holder {
+    static constexpr char value = 0;
+};
+template <class T> constexpr char type_id_holder<T>::value;
+} // namespace detail
+
+/// Unique identifier of the type `T`.
+template <class T> constexpr type_id type_id_v = &detail::type_id_holder<T>::value;
+
+/// Runtime information about a member of the described type.
+struct member_descriptor {
+    /// member name
+    zstring_view name;
+    /// byte offset of the member inside the owner object
+    std::size_t offset;
+    /// `sizeof` of the member type
+    std::size_t size;
+    /// kind of the member type
+    member_kind kind;
+    /// table of the member type if the kind is @ref member_kind::described, `nullptr` otherwise
+    const member_table* nested;
+    /// conversions of the member type if the kind is @ref member_kind::enumeration and the enumeration is described,
+    /// `nullptr` otherwise
+    const enum_table* enumeration;
+    /// identifier of the member type, `type_id_v<M>`
+    type_id type;
+
+    /// @return true if the member type is `M`
+    template <class M> bool is() const noexcept { return type == type_id_v<M>; }
+
+    /// @return address of the member inside the `owner` object
+    void* address(void* owner) const noexcept { return static_cast<char*>(owner) + offset; }
+    /// @return address of the member inside the `owner` object
+    const void* address(const void* owner) const noexcept { return static_cast<const char*>(owner) + offset; }
+};
+
+/// Array of member descriptors of the described type.
+/// The order of members is the order of the type description.
+struct member_table {
+    const member_descriptor* members;
+    std::size_t members_count;
+    /// `sizeof` of the described type
+    std::size_t type_size;
+    /// index of the member with the given name or `string_view::npos`, see @ref find_member_index
+    std::size_t (*find_index)(string_view name) noexcept;
+
+    constexpr std::size_t size() const noexcept { return members_count; }
+    constexpr bool empty() const noexcept { return members_count == 0; }
+    constexpr const member_descriptor* begin() const noexcept { return members; }
+    constexpr const member_descriptor* end() const noexcept { return members + members_count; }
+    constexpr const member_descriptor& operator[](std::size_t i) const noexcept { return members[i]; }
+
+    /// @return descriptor of the member with the given name or `nullptr`
+    const member_descriptor* find(string_view name) const noexcept {
+        const std::size_t index = find_index(name);
+        return index == string_view::npos ? nullptr : members + index;
+    }
+};
+
+namespace detail {
+template <class T, class = void> struct has_static_members : false_type {};
+template <class T>
+struct has_static_members<T, std::enable_if_t<!decltype(is_none(static_type_members_v<T>))::value>>
+  : true_type {};
+
+template <class T> struct is_std_string : false_type {};
+template <class... Ts> struct is_std_string<std::basic_string<char, Ts...>> : true_type {};
+
+template <class T> struct is_std_vector : false_type {};
+template <class T, class A> struct is_std_vector<std::vector<T, A>> : true_type {};
+
+template <class T> struct is_fixed_array : false_type {};
+template <class T, std::size_t N> struct is_fixed_array<std::array<T, N>> : true_type {};
+template <class T, std::size_t N> struct is_fixed_array<T[N]> : true_type {};
+
+template <class M> constexpr member_kind get_member_kind() noexcept {
+    if (std::is_same<M, bool>::value)
+        return member_kind::boolean;
+    if (std::is_integral<M>::value)
+        return std::is_signed<M>::value ? member_kind::signed_integer : member_kind::unsigned_integer;
+    if (std::is_floating_point<M>::value)
+        return member_kind::floating_point;
+    if (std::is_enum<M>::value)
+        return member_kind::enumeration;
+    if (is_std_string<M>::value)
+        return member_kind::string;
+    if (std::is_same<M, string_view>::value || std::is_same<M, zstring_view>::value)
+        return member_kind::string_view;
+    if (has_static_members<M>::value)
+        return member_kind::described;
+    return member_kind::other;
+}
+
+template <class T> const member_table& get_member_table() noexcept;
+
+template <class M> const member_table* nested_member_table(true_type) noexcept { return &get_member_table<M>(); }
+template <class M> const member_table* nested_member_table(false_type) noexcept { return nullptr; }
+
+template <class E> zstring_view enum_to_string(const void* value) noexcept {
+    return ::tmdesc::to_string(*static_cast<const E*>(value));
+}
+template <class E> bool enum_from_string(string_view name, void* value) noexcept {
+    return ::tmdesc::from_string(name, *static_cast<E*>(value));
+}
+
+template <class E> const enum_table* member_enum_table(true_type) noexcept {
+    static const enum_table table{enum_index<E>::size, &enum_to_string<E>, &enum_from_string<E>};
+    return &table;
+}
+template <class E> const enum_table* member_enum_table(false_type) noexcept { return nullptr; }
+
+/// Byte offset of the member inside the `owner` object.
+/// @note C++14 has no constant expression for it, so the offset is measured once, when the table is initialized.
+template <class T, class M, class O> std::size_t member_offset(const T& owner, M O::*member_ptr) noexcept {
+    return std::size_t(reinterpret_cast<const char*>(std::addressof(owner.*member_ptr)) -
+                       reinterpret_cast<const char*>(std::addressof(owner)));
+}
+
+template <class T> struct make_member_descriptors {
+    const T& owner;
+
+    template <class MemberInfo> member_descriptor make(const MemberInfo& mi) const noexcept {
+        using value_type = typename MemberInfo::value_type;
+        return {mi.name(), member_offset(owner, mi.getter().member_pointer()), sizeof(value_type),
+                get_member_kind<value_type>(),
+                nested_member_table<value_type>(has_static_members<value_type>{}),
+                member_enum_table<value_type>(is_described_enum<value_type>{}), type_id_v<value_type>};
+    }
+    template <class... MemberInfos>
+    std::array<member_descriptor, sizeof...(MemberInfos)> operator()(const MemberInfos&... mi) const noexcept {
+        return {{make(mi)...}};
+    }
+};
+
+template <class T> const member_table& get_member_table() noexcept {
+    static_assert(has_static_members<T>::value, "the type has no members description");
+    static const auto descriptors = [] {
+        // the offsets are measured on the storage of the object, the object is not constructed,
+        // so the constructor of `T` is not required and is not called
+        const std::aligned_storage_t<sizeof(T), alignof(T)> storage{};
+        return unpack(static_type_members_v<T>.value(),
+                      make_member_descriptors<T>{*reinterpret_cast<const T*>(std::addressof(storage))});
+    }();
+    static const member_table table{descriptors.data(), descriptors.size(), sizeof(T), &find_member_index<T>};
+    return table;
+}
+} // namespace detail
+
+/** Returns the runtime table of members of the described type `T`.
+
+    @details
+    The table is built once from `static_type_members_v<T>`. Runtime-generic code (type-erased serializers, admin
+    tools) iterates it without template instantiation per call site, the member `i` is accessed by `table[i]`.
+    The member address is `table[i].address(&object)`.
+
+    @note The table is initialized on the first call. The member offsets are measured by the member pointers
+    on the storage of `T`, no object of `T` is constructed. The members of virtual bases are not supported.
+ */
+template <class T> const member_table& member_table_of() noexcept { return detail::get_member_table<T>(); }
+
+} // namespace tmdesc
@@ -6,8 +6,12 @@
 // https://github.com/Ariox41/tmdesc
 
 #pragma once
+#include "algorithm/unpack.hpp"
+#include "concepts/searchable.hpp"
+#include "containers/detail/search.hpp"
+#include "core/type_t.hpp"
+#include "functional/invoke.hpp"
 #include "type_info/get_type_info.hpp"
-#include <boost/hana/tuple.hpp>
 
 namespace tmdesc {
 template <class T> struct object_members_view {
@@ -18,96 +22,157 @@ template <class T> struct object_members_view {
 };
 
 struct members_view_t {
-    template <class T, std::enable_if_t<!boost::hana::is_nothing(static_type_members_v<std::decay_t<T>>), bool> = true>
-    object_members_view<T&&> operator()(T&& object) const noexcept {
+    template <class T, std::enable_if_t<!decltype(is_none(static_type_members_v<std::decay_t<T>>))::value, bool> = true>
+    constexpr object_members_view<T&&> operator()(T&& object) const noexcept {
         return {std::forward<T>(object)};
     }
 };
-constexpr members_view_t members_view;
+
+/// Foldable view of the described object members, each element is a @ref member_reference.
+/// @details usage: `for_each(members_view(object), [](auto member) { member.name(); member.get(); })`
+constexpr members_view_t members_view{};
 
 namespace tags {
 struct members_view_tag {};
 } // namespace tags
 
-// namespace detail {
-//template <class T> constexpr const auto& existing_members_info_v = ::tmdesc::static_type_members_v<T>.value();
+namespace meta {
+template <class T> struct tag_of<object_members_view<T>> { using type = ::tmdesc::tags::members_view_tag; };
+} // namespace meta
 
-// template <std::size_t I, class T>
-//constexpr const auto& existing_info_of_member_at_v = hana::at_c<I>(existing_members_info_v<T>);
+/// The reference to object member with name and attributes.
+template <class Owner, class MemberInfo> struct member_reference {
+    using owner_type     = std::decay_t<Owner>;
+    using value_type     = typename MemberInfo::value_type;
+    using reference_type = decltype(std::declval<const MemberInfo&>().getter()(std::declval<Owner>()));
 
-// template <std::size_t I, class T>
-//constexpr const auto& existing_member_getter_at_v = existing_info_of_member_at_v<I, T>.getter();
+    constexpr member_reference(Owner&& owner, const MemberInfo& info) noexcept
+      : owner_(static_cast<Owner&&>(owner))
+      , info_(info) {}
+    constexpr member_reference(const member_reference&) = default;
+    constexpr member_reference& operator=(const member_reference&) = delete;
 
-// template <std::size_t I, class T>
-//using existing_member_type_at = typename std::decay_t<decltype(existing_info_of_member_at_v<I, T>)>::value_type;
-//} // namespace detail
+    /// \return reference to member. The member type qualifiers depend on the object type qualifiers
+    constexpr reference_type get() const noexcept { return info_.getter()(static_cast<Owner&&>(owner_)); }
 
-///// The reference to object member with name and attributes.
-// template <class Owner, std::size_t I> struct member_reference {
-//     using owner_type     = std::decay_t<Owner>;
-//    using reference_type = decltype(detail::existing_member_getter_at_v<I, owner_type>(std::declval<Owner>()));
-//    using value_type     = detail::existing_member_type_at<I, owner_type>;
+    /// \return name of member
+    constexpr zstring_view name() const noexcept { return info_.name(); }
 
-// private:
-//     Owner owner_;
+    /// \return attributes of member. The attributes has type of `dict<pair<Tags, Values>...>`
+    constexpr decltype(auto) attributes() const noexcept { return info_.attributes(); }
 
-// public:
-//    explicit constexpr member_reference(Owner owner) noexcept
-//      : owner_(owner){};
-//    constexpr member_reference(const member_reference&) = default;
-//    constexpr member_reference& operator=(const member_reference&) = delete;
+    /// \return @ref member_info of member
+    constexpr const MemberInfo& info() const noexcept { return info_; }
 
-//    /// \return reference to member. The member type qualifiers depend on the object type qualifiers
-//    constexpr reference_type get() const noexcept {
-//        return detail::existing_member_getter_at_v<I, owner_type>(static_cast<Owner&&>(owner_));
-//    }
+private:
+    Owner&& owner_;
+    const MemberInfo& info_;
+};
 
-//    /// \return name of member
-//    static constexpr zstring_view name() noexcept { return detail::existing_info_of_member_at_v<I, owner_type>.name(); }
+namespace detail {
+template <class Owner, class Fn> struct make_member_references {
+    Owner&& owner;
+    Fn&& fn;
 
-//    /// \return index of member
-//    static constexpr std::size_t index() noexcept { return I; }
+    template <class... MI> constexpr decltype(auto) operator()(const MI&... mi) const {
+        return invoke(static_cast<Fn&&>(fn), member_reference<Owner, MI>{static_cast<Owner&&>(owner), mi}...);
+    }
+};
+} // namespace detail
 
-//    /// \return attributes of member. The attributes has type of `map<pair<type<Tags>, Values>...>`
-//    static constexpr decltype(auto) attributes() noexcept {
-//        return detail::existing_info_of_member_at_v<I, owner_type>.attributes();
-//    }
-//};
+/// `unpack` implementation for members view: fn(member_reference1, ..., member_referenceN)
+template <> struct unpack_impl<tags::members_view_tag> {
+    template <typename Xs, typename F> static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+        using owner_type = typename std::decay_t<Xs>::owner_object_type;
+        return unpack(static_type_members_v<std::decay_t<owner_type>>.value(),
+                      detail::make_member_references<owner_type, F>{static_cast<owner_type>(xs.owner_object),
+                                                                    static_cast<F&&>(f)});
+    }
+};
 
 namespace detail {
-template <class O, class Getter, class AS> struct member_reference {
-    using owner_type     = std::decay_t<O>;
-    using reference_type = decltype(std::declval<Getter>()(std::declval<O>()));
-    using value_type     = typename std::decay_t<Getter>::member_type;
+/// Evaluates the predicate for each member in the constant expression
+template <class P> struct members_find_if_index {
+    template <class... MI> constexpr std::size_t operator()(const MI&... mi) const noexcept {
+        const bool matches[] = {search_predicate_value<P>(mi)..., true};
+        std::size_t i        = 0;
+        while (!matches[i])
+            ++i;
+        return i;
+    }
+};
 
-    /// \return reference to member. The member type qualifiers depend on the object type qualifiers
-    constexpr reference_type get() const noexcept {
-        return ;
+template <class Tag> struct has_attribute {
+    template <class MemberInfo>
+    constexpr has_key<decltype(std::declval<const MemberInfo&>().attributes()), Tag>
+    operator()(const MemberInfo&) const noexcept {
+        return {};
     }
+};
 
-    /// \return name of member
-    static constexpr zstring_view name() noexcept { return detail::existing_info_of_member_at_v<I, owner_type>.name(); }
+template <std::size_t I, class Owner, class T = std::decay_t<Owner>>
+using member_reference_at =
+    member_reference<Owner, std::decay_t<decltype(at_c<I>(static_type_members_v<T>.value()))>>;
 
-    /// \return index of member
-    static constexpr std::size_t index() noexcept { return I; }
+template <std::size_t I, class Owner>
+constexpr some_t<member_reference_at<I, Owner>> members_find(Owner&& owner, true_type) noexcept {
+    return some_t<member_reference_at<I, Owner>>{member_reference_at<I, Owner>{
+        static_cast<Owner&&>(owner), at_c<I>(static_type_members_v<std::decay_t<Owner>>.value())}};
+}
+template <std::size_t I, class Owner> constexpr none_t members_find(Owner&&, false_type) noexcept { return none; }
+} // namespace detail
 
-    /// \return attributes of member. The attributes has type of `map<pair<type<Tags>, Values>...>`
-    static constexpr decltype(auto) attributes() noexcept {
-        return detail::existing_info_of_member_at_v<I, owner_type>.attributes();
+/** `find_if` implementation for members view.
+
+    @details
+    The predicate is invoked with the @ref member_info of each member in the constant expression, see @ref find_if,
+    so it can check the member name, attributes and `value_type`:
+    @code
+    struct is_id {
+        template <class MI> constexpr bool operator()(const MI& mi) const noexcept { return mi.name() == "id"; }
+    };
+    auto id = tmdesc::find_if(tmdesc::members_view(obj), is_id{}); // some(member_reference) or none
+    @endcode
+    @return `some(member_reference)` of the first matching member or `none`
+ */
+template <> struct find_if_impl<tags::members_view_tag> {
+    template <class Xs> using owner_of = typename std::decay_t<Xs>::owner_object_type;
+    template <class Xs, class P>
+    using found_index = size_constant<unpack(static_type_members_v<std::decay_t<owner_of<Xs>>>.value(),
+                                             detail::members_find_if_index<std::decay_t<P>>{})>;
+    template <class Xs, class P>
+    using found = bool_constant<(found_index<Xs, P>::value <
+                                 decltype(size(static_type_members_v<std::decay_t<owner_of<Xs>>>.value()))::value)>;
+
+    template <class Xs, class P>
+    static constexpr auto apply(Xs&& xs, P&&) noexcept
+        -> decltype(detail::members_find<found_index<Xs, P>::value>(std::declval<owner_of<Xs>>(), found<Xs, P>{})) {
+        return detail::members_find<found_index<Xs, P>::value>(static_cast<owner_of<Xs>>(xs.owner_object),
+                                                              found<Xs, P>{});
     }
 };
 
-} // namespace detail
-
-} // namespace tmdesc
+/// `find` is not implemented for members view: the members have no key, use @ref find_if
+/// or @ref find_with_attribute
+template <> struct find_impl<tags::members_view_tag> : core::unimplemented {
+    template <class C, class Key> static constexpr auto apply(C&& container, const Key& key) = delete;
+};
 
-namespace boost {
-namespace hana {
-template <class T> struct tag_of<::tmdesc::members_view_t<T>> { using type = ::tmdesc::tags::members_view_tag; };
-template <> struct unpack_impl<::tmdesc::tags::members_view_tag> {
-    template <typename Xs, typename F> static constexpr auto apply(Xs&& xs, F&& f) {
-        return unpack_impl<basic_tuple_tag>(std::forward<Xs>(xs).tup, std::forward<F>(f));
+/// Finds the first member with the attribute `Tag` and returns `some(member_reference)` or `none`
+/// @code
+/// tmdesc::find_with_attribute(tmdesc::members_view(obj), tmdesc::type_c<note_tag>)
+/// @endcode
+#ifdef TMDESC_DOXYGEN
+constexpr auto find_with_attribute = [](auto&& members_view, auto tag) {};
+#else
+struct find_with_attribute_t {
+    template <class Xs, class Tag>
+    constexpr auto operator()(Xs&& xs, type_t<Tag>) const noexcept
+        -> decltype(find_if(std::declval<Xs>(), detail::has_attribute<Tag>{})) {
+        return find_if(static_cast<Xs&&>(xs), detail::has_attribute<Tag>{});
     }
 };
-} // namespace hana
-} // namespace boost
+constexpr find_with_attribute_t find_with_attribute{};
+#endif
+
+} // namespace tmdesc
@@ -0,0 +1,538 @@
+// Copyright Victor Smirnov 2021-2022
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+//
+// The documentation can be found at the library's page:
+// https://github.com/Ariox41/tmdesc
+
+#pragma once
+#include "algorithm/for_each.hpp"
+#include "borrowed.hpp"
+#include "instrumentation.hpp"
+#include "max_size.hpp"
+#include "member_table.hpp"
+#include "members_view.hpp"
+#include "meta/logical_operations.hpp"
+#include "size_history.hpp"
+#include "type_info/member_index.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/// Maximal nesting depth of the values written by @ref tmdesc::encode_graph and read by @ref tmdesc::decode_graph
+#ifndef TMDESC_GRAPH_MAX_DEPTH
+#define TMDESC_GRAPH_MAX_DEPTH 1000
+#endif
+
+namespace tmdesc {
+struct decode_graph_t;
+
+/// Maximal nesting depth of the encoded values, see @ref TMDESC_GRAPH_MAX_DEPTH
+constexpr std::size_t graph_max_depth = TMDESC_GRAPH_MAX_DEPTH;
+
+namespace detail {
+/** Open addressing hash table of the object addresses, each new object gets the next identifier.
+
+    @details
+    The key is the address together with the type, so an object and its first member have different identifiers.
+    The table uses the linear probing and the Fibonacci hashing of the address, the load factor is at most 1/2.
+ */
+class pointer_id_table {
+public:
+    /// @return identifier of the object and `true` if the object is inserted now
+    std::pair<std::size_t, bool> insert(const void* address, type_id type) {
+        if ((size_ + 1) * 2 > slots_.size())
+            grow();
+        for (std::size_t i = hash(address, type);; i = (i + 1) & (slots_.size() - 1)) {
+            slot& s = slots_[i];
+            if (s.address == nullptr) {
+                s = slot{address, type, size_};
+                return {size_++, true};
+            }
+            if (s.address == address && s.type == type)
+                return {s.id, false};
+        }
+    }
+
+    /// @return count of the inserted objects
+    std::size_t size() const noexcept { return size_; }
+
+private:
+    struct slot {
+        const void* address;
+        type_id type;
+        std::size_t id;
+    };
+
+    std::size_t hash(const void* address, type_id type) const noexcept {
+        const std::uint64_t key = std::uint64_t(reinterpret_cast<std::uintptr_t>(address)) ^
+                                  (std::uint64_t(reinterpret_cast<std::uintptr_t>(type)) << 1);
+        return std::size_t((key * 0x9E3779B97F4A7C15ull) >> (64 - bits_));
+    }
+
+    void grow() {
+        bits_ = bits_ == 0 ? 4 : bits_ + 1;
+        std::vector<slot> old(std::size_t(1) << bits_, slot{nullptr, nullptr, 0});
+        old.swap(slots_);
+        for (const slot& s : old) {
+            if (s.address == nullptr)
+                continue;
+            std::size_t i = hash(s.address, s.type);
+            while (slots_[i].address != nullptr)
+                i = (i + 1) & (slots_.size() - 1);
+            slots_[i] = s;
+        }
+    }
+
+    std::vector<slot> slots_;
+    std::size_t size_ = 0;
+    unsigned bits_    = 0;
+};
+
+template <class T> struct is_shared_ptr : false_type {};
+template <class T> struct is_shared_ptr<std::shared_ptr<T>> : true_type {};
+
+enum class graph_kind {
+    boolean,
+    integer,
+    floating_point,
+    enumeration,
+    string,
+    string_view,
+    vector,
+    array,
+    shared_pointer,
+    raw_pointer,
+    described,
+    other
+};
+
+template <class T> constexpr graph_kind get_graph_kind() noexcept {
+    if (std::is_same<T, bool>::value)
+        return graph_kind::boolean;
+    if (std::is_integral<T>::value)
+        return graph_kind::integer;
+    if (std::is_floating_point<T>::value)
+        return graph_kind::floating_point;
+    if (std::is_enum<T>::value)
+        return graph_kind::enumeration;
+    if (is_std_string<T>::value || is_inline_string<T>::value)
+        return graph_kind::string;
+    if (is_borrowed_string<T>::value)
+        return graph_kind::string_view;
+    if (is_std_vector<T>::value || is_small_vector<T>::value)
+        return graph_kind::vector;
+    if (is_fixed_array<T>::value)
+        return graph_kind::array;
+    if (is_shared_ptr<T>::value)
+        return graph_kind::shared_pointer;
+    if (std::is_pointer<T>::value && std::is_object<std::remove_pointer_t<T>>::value)
+        return graph_kind::raw_pointer;
+    if (has_static_members<T>::value)
+        return graph_kind::described;
+    return graph_kind::other;
+}
+template <graph_kind K> using graph_kind_c = std::integral_constant<graph_kind, K>;
+
+template <class... Ts> struct graph_visited_types {};
+
+/// `true_type` if the value of `T` contains a raw pointer, directly or through the members, elements and pointees.
+/// The described types already in `Visited` are not checked again, so the recursive types are supported.
+template <class T, class Visited = graph_visited_types<>, graph_kind K = get_graph_kind<T>()>
+struct graph_has_raw_pointer : false_type {};
+template <class T, class Visited>
+struct graph_has_raw_pointer<T, Visited, graph_kind::raw_pointer> : true_type {};
+template <class T, class Visited>
+struct graph_has_raw_pointer<T, Visited, graph_kind::shared_pointer>
+  : graph_has_raw_pointer<std::remove_const_t<typename T::element_type>, Visited> {};
+template <class T, class Visited>
+struct graph_has_raw_pointer<T, Visited, graph_kind::vector>
+  : graph_has_raw_pointer<typename T::value_type, Visited> {};
+template <class T, class Visited>
+struct graph_has_raw_pointer<T, Visited, graph_kind::array>
+  : graph_has_raw_pointer<std::decay_t<decltype(std::declval<T&>()[0])>, Visited> {};
+
+template <class T, class Visited, class Indices> struct graph_members_have_raw_pointer;
+template <class T, class... Vs, std::size_t... Is>
+struct graph_members_have_raw_pointer<T, graph_visited_types<Vs...>, std::index_sequence<Is...>>
+  : bool_constant<meta::fast_values_or_v<graph_has_raw_pointer<
+        typename std::decay_t<decltype(at_c<Is>(static_type_members_v<T>.value()))>::value_type,
+        graph_visited_types<T, Vs...>>...>> {};
+
+template <class T, class... Vs>
+struct graph_has_raw_pointer<T, graph_visited_types<Vs...>, graph_kind::described>
+  : std::conditional_t<meta::fast_or_v<std::is_same<T, Vs>::value...>, false_type,
+                       graph_members_have_raw_pointer<T, graph_visited_types<Vs...>,
+                                                      std::make_index_sequence<members_count_v<T>>>> {};
+
+/// unsigned integer with the size of `T`, the values are written in the little endian order
+template <class T>
+using graph_bits_t =
+    std::conditional_t<sizeof(T) == 1, std::uint8_t,
+                       std::conditional_t<sizeof(T) == 2, std::uint16_t,
+                                          std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>>>;
+
+struct graph_encoder {
+    std::string& out;
+    pointer_id_table ids{};
+    bool ok = true;
+    /// nesting depth of the value being encoded, the encoding is recursive
+    std::size_t depth = 0;
+
+    template <class T> void operator()(const T& value) {
+        if (!ok)
+            return;
+        if (depth == graph_max_depth) {
+            ok = false;
+            return;
+        }
+        ++depth;
+        encode(value, graph_kind_c<get_graph_kind<T>()>{});
+        --depth;
+    }
+
+    void put_varint(std::uint64_t value) {
+        for (; value >= 0x80; value >>= 7)
+            out += char(value | 0x80);
+        out += char(value);
+    }
+    template <class T> void put_fixed(const T& value) {
+        static_assert(sizeof(T) == sizeof(graph_bits_t<T>), "unsupported size of the arithmetic type");
+        graph_bits_t<T> bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        for (std::size_t i = 0; i < sizeof(bits); ++i)
+            out += char(std::uint64_t(bits) >> (8 * i));
+    }
+    void put_string(const char* data, std::size_t size) {
+        put_varint(size);
+        out.append(data, size);
+    }
+
+    template <class T> void encode(const T& value, graph_kind_c<graph_kind::boolean>) { out += char(value ? 1 : 0); }
+    template <class T> void encode(const T& value, graph_kind_c<graph_kind::integer>) { put_fixed(value); }
+    template <class T> void encode(const T& value, graph_kind_c<graph_kind::floating_point>) { put_fixed(value); }
+    template <class T> void encode(const T& value, graph_kind_c<graph_kind::enumeration>) {
+        put_fixed(static_cast<std::underlying_type_t<T>>(value));
+    }
+    template <class T> void encode(const T& value, graph_kind_c<graph_kind::string>) {
+        put_string(value.data(), value.size());
+    }
+    template <class T> void encode(const T& value, graph_kind_c<graph_kind::string_view>) {
+        put_string(value.data(), value.size());
+    }
+    template <class T> void encode(const T& value, graph_kind_c<graph_kind::vector>) {
+        put_varint(value.size());
+        for (const auto& item : value)
+            (*this)(item);
+    }
+    template <class T> void encode(const T& value, graph_kind_c<graph_kind::array>) {
+        for (const auto& item : value)
+            (*this)(item);
+    }
+    template <class T> void encode(const T& value, graph_kind_c<graph_kind::shared_pointer>) {
+        encode_pointee(value.get());
+    }
+    template <class T> void encode(const T& value, graph_kind_c<graph_kind::raw_pointer>) { encode_pointee(value); }
+    template <class T> void encode(const T& value, graph_kind_c<graph_kind::described>) {
+        for_each(members_view(value), member_encoder{*this});
+    }
+    template <class T> void encode(const T&, graph_kind_c<graph_kind::other>) {
+        static_assert(get_graph_kind<T>() != graph_kind::other, "the type is not supported by encode_graph");
+    }
+
+    /// null is 0, the object is `id + 1`, the first occurrence of the object is followed by its value
+    template <class U> void encode_pointee(U* pointee) {
+        if (pointee == nullptr)
+            return put_varint(0);
+        const auto id = ids.insert(pointee, type_id_v<std::remove_const_t<U>>);
+        put_varint(id.first + 1);
+        if (id.second)
+            (*this)(*pointee);
+    }
+
+    struct member_encoder {
+        graph_encoder& encoder;
+        template <class M> void operator()(M member) const {
+            encode(member, bool_constant<is_borrowed_member_v<std::decay_t<decltype(member.info())>>>{});
+        }
+        template <class M> void encode(M member, true_type) const {
+            encoder.put_string(member.get().data(), member.get().size());
+        }
+        template <class M> void encode(M member, false_type) const { encoder(member.get()); }
+    };
+};
+
+struct graph_decoder;
+} // namespace detail
+
+/** Owner of the objects created by @ref decode_graph for the pointer members.
+
+    @details
+    Each object referenced by `std::shared_ptr` or by a raw pointer is allocated once and kept by the storage,
+    so the raw pointers of the decoded value are valid while the storage exists.
+    The storage may be reused by several calls of @ref decode_graph, the objects of all calls are kept.
+ */
+class object_graph_storage {
+public:
+    /// @return count of the kept objects
+    std::size_t size() const noexcept { return objects_.size(); }
+    /// Releases the kept objects, the raw pointers of the decoded values become dangling
+    void clear() noexcept { objects_.clear(); }
+
+private:
+    friend struct detail::graph_decoder;
+    friend struct decode_graph_t;
+    struct entry {
+        std::shared_ptr<void> object;
+        type_id type;
+    };
+    std::vector<entry> objects_;
+};
+
+namespace detail {
+struct graph_decoder {
+    const char* pos;
+    const char* end;
+    std::vector<object_graph_storage::entry>& objects;
+    /// index of the first object of this input in the storage
+    std::size_t base = objects.size();
+    bool ok          = true;
+    /// limit of the size of the string or sequence being decoded, see @ref tags::max_size
+    std::size_t max_size = unlimited_size;
+    /// nesting depth of the value being decoded, the decoding is recursive
+    std::size_t depth = 0;
+
+    template <class T> void operator()(T& value, std::size_t size_limit = unlimited_size) {
+        if (!ok)
+            return;
+        if (depth == graph_max_depth)
+            return (void)fail();
+        ++depth;
+        max_size = size_limit;
+        decode(value, graph_kind_c<get_graph_kind<T>()>{});
+        --depth;
+    }
+
+    bool fail() noexcept { return ok = false; }
+
+    bool get_varint(std::uint64_t& value) {
+        value = 0;
+        for (unsigned shift = 0; shift < 64; shift += 7) {
+            if (pos == end)
+                return fail();
+            const auto byte = static_cast<unsigned char>(*pos++);
+            value |= std::uint64_t(byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0)
+                return true;
+        }
+        return fail();
+    }
+    template <class T> bool get_fixed(T& value) {
+        graph_bits_t<T> bits = 0;
+        if (std::size_t(end - pos) < sizeof(bits))
+            return fail();
+        for (std::size_t i = 0; i < sizeof(bits); ++i)
+            bits = graph_bits_t<T>(bits | std::uint64_t(static_cast<unsigned char>(*pos++)) << (8 * i));
+        std::memcpy(&value, &bits, sizeof(bits));
+        return true;
+    }
+    /// @return the string bytes in the input
+    bool get_string(string_view& value, std::size_t size_limit) {
+        std::uint64_t size = 0;
+        if (!get_varint(size))
+            return false;
+        if (size > std::uint64_t(end - pos) || size > size_limit)
+            return fail();
+        value = string_view(pos, std::size_t(size));
+        pos += size;
+        return true;
+    }
+
+    template <class T> void decode(T& value, graph_kind_c<graph_kind::boolean>) {
+        std::uint8_t byte = 0;
+        if (get_fixed(byte))
+            value = byte != 0;
+    }
+    template <class T> void decode(T& value, graph_kind_c<graph_kind::integer>) { get_fixed(value); }
+    template <class T> void decode(T& value, graph_kind_c<graph_kind::floating_point>) { get_fixed(value); }
+    template <class T> void decode(T& value, graph_kind_c<graph_kind::enumeration>) {
+        std::underlying_type_t<T> underlying{};
+        if (get_fixed(underlying))
+            value = static_cast<T>(underlying);
+    }
+    template <class T> void decode(T& value, graph_kind_c<graph_kind::string>) {
+        string_view bytes;
+        if (get_string(bytes, max_size))
+            value.assign(bytes.data(), bytes.size());
+    }
+    template <class T> void decode(T& value, graph_kind_c<graph_kind::string_view>) {
+        string_view bytes;
+        if (get_string(bytes, max_size))
+            value = T(bytes.data(), bytes.size());
+    }
+    template <class T> void decode(T& value, graph_kind_c<graph_kind::vector>) {
+        std::uint64_t size = 0;
+        if (!get_varint(size))
+            return;
+        // rejects the sizes which can't be in the input before allocating, only the elements of empty types
+        // take no bytes
+        if (size > max_size || (size > std::uint64_t(end - pos) && !std::is_empty<typename T::value_type>::value))
+            return (void)fail();
+        value.clear();
+        value.resize(std::size_t(size));
+        for (auto& item : value)
+            (*this)(item);
+    }
+    template <class T> void decode(T& value, graph_kind_c<graph_kind::array>) {
+        for (auto& item : value)
+            (*this)(item);
+    }
+    template <class T> void decode(T& value, graph_kind_c<graph_kind::shared_pointer>) {
+        value = decode_pointee<std::remove_const_t<typename T::element_type>>();
+    }
+    template <class T> void decode(T& value, graph_kind_c<graph_kind::raw_pointer>) {
+        value = decode_pointee<std::remove_const_t<std::remove_pointer_t<T>>>().get();
+    }
+    template <class T> void decode(T& value, graph_kind_c<graph_kind::described>) {
+        for_each(members_view(value), member_decoder{*this});
+    }
+    template <class T> void decode(T&, graph_kind_c<graph_kind::other>) {
+        static_assert(get_graph_kind<T>() != graph_kind::other, "the type is not supported by decode_graph");
+    }
+
+    /// the object is created and kept by the storage before its value is decoded, so the cycles are restored
+    template <class U> std::shared_ptr<U> decode_pointee() {
+        std::uint64_t ref = 0;
+        if (!get_varint(ref) || ref == 0)
+            return nullptr;
+        const std::uint64_t id = ref - 1;
+        if (id < objects.size() - base) {
+            const object_graph_storage::entry& e = objects[base + std::size_t(id)];
+            if (e.type != type_id_v<U>)
+                return fail(), nullptr;
+            return std::static_pointer_cast<U>(e.object);
+        }
+        if (id != objects.size() - base)
+            return fail(), nullptr;
+        auto object = std::make_shared<U>();
+        objects.push_back({object, type_id_v<U>});
+        (*this)(*object);
+        return object;
+    }
+
+    struct member_decoder {
+        graph_decoder& decoder;
+        template <class M> void operator()(M member) const {
+            using attribute_type = std::decay_t<decltype(member.attributes())>;
+            if (decoder.ok)
+                decode(member, max_size_of<attribute_type>::get(member.attributes()),
+                       bool_constant<is_borrowed_member_v<std::decay_t<decltype(member.info())>>>{});
+        }
+        template <class M> void decode(M member, std::size_t size_limit, true_type) const {
+            string_view bytes;
+            if (decoder.get_string(bytes, size_limit))
+                member.get() = typename M::value_type(bytes.data(), bytes.size());
+        }
+        template <class M> void decode(M member, std::size_t size_limit, false_type) const {
+            decoder(member.get(), size_limit);
+        }
+    };
+};
+} // namespace detail
+
+/** Appends the binary encoding of the value to `out`, each object referenced by pointers is written once.
+
+    @details
+    The value is encoded recursively, in the order of the members description:
+    - `bool` is one byte, integers, floating point values and enumerations have the size of the type and
+      the little endian order;
+    - `std::string`, @ref inline_string, @ref string_view and borrowed members (see @ref is_borrowed_member)
+      are the size and the bytes;
+    - `std::vector` and @ref small_vector are the size and the elements, `std::array` and built-in arrays are
+      the elements;
+    - `std::shared_ptr<U>` and `U*` are the identifier of the object, the first occurrence of the object
+      is followed by its value, the next occurrences are only the identifier;
+    - described types are their members.
+
+    The objects are identified by the address and the type, so the subobjects shared by several pointers are
+    written once, and the cycles are finite. The sizes and identifiers are variable-length integers.
+    @code
+    auto shared = std::make_shared<subtree>(load_subtree());
+    config c{shared, shared};
+    std::string out;
+    tmdesc::encode_graph(c, out); // the subtree is written once
+    @endcode
+    The encoding is recursive, so the nesting depth of the values, including the objects referenced by pointers,
+    is limited by @ref graph_max_depth: a long linked list is not written instead of overflowing the stack.
+    @return `false` if the nesting depth exceeds @ref graph_max_depth, then `out` is not changed
+    @see decode_graph, instrumented_encode_graph
+ */
+#ifdef TMDESC_DOXYGEN
+constexpr auto encode_graph = [](const auto& value, std::string& out) -> bool {};
+#else
+template <class Policy> struct instrumented_encode_graph_t {
+    template <class T> bool operator()(const T& value, std::string& out) const {
+        typename Policy::template scope<T> instrumentation_scope;
+        detail::reserve_by_policy<T>(Policy{}, out);
+        const std::size_t start = out.size();
+        detail::graph_encoder encoder{out};
+        encoder(value);
+        if (!encoder.ok) {
+            out.resize(start);
+            return false;
+        }
+        instrumentation_scope.add_bytes(out.size() - start);
+        return true;
+    }
+};
+using encode_graph_t = instrumented_encode_graph_t<no_instrumentation>;
+constexpr encode_graph_t encode_graph{};
+#endif
+
+/// @ref encode_graph with the instrumentation policy, for example @ref size_tracking.
+/// @details Each call reports the encoded bytes for the type of the value. With @ref size_tracking
+/// the output is reserved for the expected size of the type before encoding, see @ref reserve_expected.
+template <class Policy> constexpr instrumented_encode_graph_t<Policy> instrumented_encode_graph{};
+
+/** Decodes the value encoded by @ref encode_graph, the objects shared in the encoded value are shared again.
+
+    @details
+    Each object referenced by pointers is created once by `std::make_shared` and kept by the `storage`,
+    all pointers to it refer to the same object, including the cycles. The pointee types must be
+    default constructible. @ref string_view and borrowed members refer to the `input`,
+    so the input must outlive the decoded value. The size of the member with the @ref tags::max_size attribute
+    is checked before the member is filled, so @ref inline_string and @ref small_vector members within the limit
+    are decoded without allocation.
+
+    @param input - the encoded value
+    @param value - the decoded value, partially changed if the decoding fails
+    @param storage - owner of the created objects, must outlive the raw pointers of the decoded value;
+    the overload without it does not compile for the values containing raw pointers
+    @return `false` if the input is truncated or malformed, a member size exceeds its limit, or the nesting depth
+    exceeds @ref graph_max_depth
+ */
+#ifdef TMDESC_DOXYGEN
+constexpr auto decode_graph = [](string_view input, auto& value, object_graph_storage& storage) -> bool {};
+#else
+struct decode_graph_t {
+    template <class T> bool operator()(string_view input, T& value, object_graph_storage& storage) const {
+        detail::graph_decoder decoder{input.data(), input.data() + input.size(), storage.objects_};
+        decoder(value);
+        return decoder.ok;
+    }
+    template <class T> bool operator()(string_view input, T& value) const {
+        static_assert(!detail::graph_has_raw_pointer<T>::value,
+                      "the raw pointers would refer to the destroyed objects, pass the object_graph_storage");
+        object_graph_storage storage;
+        return (*this)(input, value, storage);
+    }
+};
+constexpr decode_graph_t decode_graph{};
+#endif
+
+} // namespace tmdesc
@@ -0,0 +1,202 @@
+// Copyright Victor Smirnov 2021-2022
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+//
+// The documentation can be found at the library's page:
+// https://github.com/Ariox41/tmdesc
+
+#pragma once
+#include "algorithm/for_each.hpp"
+#include "enum_flags.hpp"
+#include "max_size.hpp"
+#include "member_table.hpp"
+#include "members_view.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace tmdesc {
+
+/// Uniform distribution of sizes in the range `[min, max]`.
+struct uniform_size {
+    std::size_t min;
+    std::size_t max;
+
+    template <class Rng> std::size_t operator()(Rng& rng) const {
+        return std::uniform_int_distribution<std::size_t>(min, max)(rng);
+    }
+};
+
+/** Options of @ref random_fill.
+
+    @details
+    The size members are invocable with the random generator and return the size of the generated string or
+    container, `random_fill` also accepts any other options type with the same members, so the sizes can be
+    drawn from any distribution.
+ */
+template <class StringSize = uniform_size, class ContainerSize = uniform_size> struct basic_random_fill_options {
+    /// length of `std::string` values
+    StringSize string_size{0, 16};
+    /// count of `std::vector` elements
+    ContainerSize container_size{0, 8};
+    /// characters of `std::string` values, must not be empty
+    string_view alphabet = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+    /// range of floating point values
+    double float_min = -1000.0;
+    /// range of floating point values
+    double float_max = 1000.0;
+};
+using random_fill_options = basic_random_fill_options<>;
+
+namespace detail {
+enum class random_fill_kind {
+    boolean,
+    integer,
+    floating_point,
+    enumeration,
+    flags,
+    string,
+    vector,
+    array,
+    described,
+    other
+};
+
+template <class T> constexpr random_fill_kind get_random_fill_kind() noexcept {
+    if (std::is_same<T, bool>::value)
+        return random_fill_kind::boolean;
+    if (std::is_integral<T>::value)
+        return random_fill_kind::integer;
+    if (std::is_floating_point<T>::value)
+        return random_fill_kind::floating_point;
+    if (is_flag_enum<T>::value)
+        return random_fill_kind::flags;
+    if (is_described_enum<T>::value)
+        return random_fill_kind::enumeration;
+    if (is_std_string<T>::value || is_inline_string<T>::value)
+        return random_fill_kind::string;
+    if (is_std_vector<T>::value || is_small_vector<T>::value)
+        return random_fill_kind::vector;
+    if (is_fixed_array<T>::value)
+        return random_fill_kind::array;
+    if (has_static_members<T>::value)
+        return random_fill_kind::described;
+    return random_fill_kind::other;
+}
+template <random_fill_kind K> using random_fill_kind_c = std::integral_constant<random_fill_kind, K>;
+
+template <class Rng, class Options> struct random_filler {
+    Rng& rng;
+    Options& options;
+    /// limit of the size of the string or sequence being filled, see @ref tags::max_size
+    std::size_t max_size = unlimited_size;
+
+    template <class T> void operator()(T& value, std::size_t size_limit = unlimited_size) {
+        max_size = size_limit;
+        fill(value, random_fill_kind_c<get_random_fill_kind<T>()>{});
+    }
+    std::size_t limited(std::size_t size) const noexcept { return size < max_size ? size : max_size; }
+
+    template <class T> void fill(T& value, random_fill_kind_c<random_fill_kind::boolean>) {
+        value = std::uniform_int_distribution<int>(0, 1)(rng) != 0;
+    }
+    template <class T> void fill(T& value, random_fill_kind_c<random_fill_kind::integer>) {
+        fill_integer(value, bool_constant<has_all_bits<T>()>{});
+    }
+    /// the low bits of the generator result are uniform, if the generator range is `[0, 2^N)` and covers the type
+    template <class T> static constexpr bool has_all_bits() noexcept {
+        using result_type = typename Rng::result_type;
+        return (Rng::min)() == 0 && ((Rng::max)() & ((Rng::max)() + result_type(1))) == 0 &&
+               std::uintmax_t((Rng::max)()) >= std::uintmax_t((std::numeric_limits<std::make_unsigned_t<T>>::max)());
+    }
+    template <class T> void fill_integer(T& value, true_type) {
+        value = static_cast<T>(static_cast<std::make_unsigned_t<T>>(rng()));
+    }
+    template <class T> void fill_integer(T& value, false_type) {
+        // the distribution is not defined for character types
+        using wide_type = std::conditional_t<std::is_signed<T>::value, long long, unsigned long long>;
+        value           = static_cast<T>(std::uniform_int_distribution<wide_type>(
+            (std::numeric_limits<T>::min)(), (std::numeric_limits<T>::max)())(rng));
+    }
+    template <class T> void fill(T& value, random_fill_kind_c<random_fill_kind::floating_point>) {
+        value = static_cast<T>(std::uniform_real_distribution<double>(options.float_min, options.float_max)(rng));
+    }
+    template <class T> void fill(T& value, random_fill_kind_c<random_fill_kind::enumeration>) {
+        if (enum_index<T>::size != 0)
+            value = static_type_enumerators_v<T>.value()[std::uniform_int_distribution<std::size_t>(
+                0, enum_index<T>::size - 1)(rng)].value();
+    }
+    template <class T> void fill(T& value, random_fill_kind_c<random_fill_kind::flags>) {
+        // unpack_flags drops the bits without the described flag, so each subset has the same probability
+        value = unpack_flags<T>(std::uniform_int_distribution<std::uint64_t>()(rng));
+    }
+    template <class T> void fill(T& value, random_fill_kind_c<random_fill_kind::string>) {
+        std::uniform_int_distribution<std::size_t> symbol(0, options.alphabet.size() - 1);
+        value.resize(limited(options.string_size(rng)));
+        for (auto& c : value)
+            c = options.alphabet[symbol(rng)];
+    }
+    template <class T> void fill(T& value, random_fill_kind_c<random_fill_kind::vector>) {
+        value.resize(limited(options.container_size(rng)));
+        for (auto& item : value)
+            (*this)(item);
+    }
+    template <class T> void fill(T& value, random_fill_kind_c<random_fill_kind::array>) {
+        for (auto& item : value)
+            (*this)(item);
+    }
+    template <class T> void fill(T& value, random_fill_kind_c<random_fill_kind::described>) {
+        for_each(members_view(value), member_filler{*this});
+    }
+    template <class T> void fill(T&, random_fill_kind_c<random_fill_kind::other>) {}
+
+    struct member_filler {
+        random_filler& filler;
+        template <class M> void operator()(M member) const {
+            using attribute_type = std::decay_t<decltype(member.attributes())>;
+            filler(member.get(), max_size_of<attribute_type>::get(member.attributes()));
+        }
+    };
+};
+} // namespace detail
+
+/** Fills the object of the described type with random values, recursively.
+
+    @details
+    - `bool` and integers are uniform in the full range of the type, floating point values are uniform in
+      `[options.float_min, options.float_max)`;
+    - described enumerations take a random enumerator, flag enumerations (see @ref is_flag_enum) take a random
+      subset of the flags;
+    - `std::string` and @ref inline_string take `options.string_size(rng)` random characters of
+      `options.alphabet`;
+    - `std::vector` and @ref small_vector are resized to `options.container_size(rng)` elements,
+      each element is filled;
+    - the sizes of the members with the @ref tags::max_size attribute do not exceed the limit;
+    - `std::array` and built-in arrays have each element filled;
+    - described types have each member filled;
+    - other types are not changed.
+
+    Used for generating benchmark corpora and fuzzing inputs without hand-written generators.
+
+    @param object - the object to fill
+    @param rng - uniform random bit generator, like `std::mt19937_64`
+    @param options - @ref random_fill_options or a type with the same members
+ */
+#ifdef TMDESC_DOXYGEN
+constexpr auto random_fill = [](auto& object, auto& rng, auto options = random_fill_options{}) -> void {};
+#else
+struct random_fill_t {
+    template <class T, class Rng, class Options = random_fill_options>
+    void operator()(T& object, Rng& rng, Options options = Options{}) const {
+        detail::random_filler<Rng, Options>{rng, options}(object);
+    }
+};
+constexpr random_fill_t random_fill{};
+#endif
+
+} // namespace tmdesc
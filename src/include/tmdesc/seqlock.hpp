@@ -0,0 +1,203 @@
+// Copyright Victor Smirnov 2021-2022
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+//
+// The documentation can be found at the library's page:
+// https://github.com/Ariox41/tmdesc
+
+#pragma once
+#include "member_table.hpp"
+#include "type_info/member_index.hpp"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
+namespace tmdesc {
+namespace detail {
+inline void seqlock_pause() noexcept {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_pause();
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    __builtin_ia32_pause();
+#endif
+}
+
+template <class T> struct seqlock_storage;
+
+/// Scalar value stored in the relaxed atomic
+template <class T> struct seqlock_cell {
+    static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value || std::is_pointer<T>::value,
+                  "seqlock members must be scalars, arrays or described types");
+    std::atomic<T> value{};
+
+    void load(T& out) const noexcept { out = value.load(std::memory_order_relaxed); }
+    void store(const T& in) noexcept { value.store(in, std::memory_order_relaxed); }
+};
+
+template <class T, std::size_t N> struct seqlock_array {
+    seqlock_storage<T> items[N];
+
+    template <class A> void load(A& out) const noexcept {
+        for (std::size_t i = 0; i < N; ++i)
+            items[i].load(out[i]);
+    }
+    template <class A> void store(const A& in) noexcept {
+        for (std::size_t i = 0; i < N; ++i)
+            items[i].store(in[i]);
+    }
+};
+
+template <class T, std::size_t I> struct seqlock_field {
+    using member_type = typename std::decay_t<decltype(at_c<I>(static_type_members_v<T>.value()))>::value_type;
+    seqlock_storage<member_type> storage;
+};
+
+template <class T, class Indices> struct seqlock_fields;
+template <class T, std::size_t... Is>
+struct seqlock_fields<T, std::index_sequence<Is...>> : seqlock_field<T, Is>... {
+    void load(T& out) const noexcept {
+        bool unused[] = {true, (seqlock_field<T, Is>::storage.load(
+                                    at_c<Is>(static_type_members_v<T>.value()).getter()(out)),
+                                true)...};
+        (void)unused;
+    }
+    void store(const T& in) noexcept {
+        bool unused[] = {true, (seqlock_field<T, Is>::storage.store(
+                                    at_c<Is>(static_type_members_v<T>.value()).getter()(in)),
+                                true)...};
+        (void)unused;
+    }
+};
+
+template <class T, bool Described = has_static_members<T>::value> struct seqlock_storage_select {
+    using type = seqlock_cell<T>;
+};
+template <class T> struct seqlock_storage_select<T, true> {
+    using type = seqlock_fields<T, std::make_index_sequence<members_count_v<T>>>;
+};
+template <class T, std::size_t N> struct seqlock_storage_select<T[N], false> {
+    using type = seqlock_array<T, N>;
+};
+template <class T, std::size_t N> struct seqlock_storage_select<std::array<T, N>, false> {
+    using type = seqlock_array<T, N>;
+};
+
+template <class T> struct seqlock_storage : seqlock_storage_select<T>::type {};
+} // namespace detail
+
+/** Holds the value of the described type, readers take consistent copies of the value without locks.
+
+    @details
+    The value is stored member by member in relaxed atomics generated from `static_type_members_v<T>`,
+    recursively for nested described types and arrays, so concurrent reads and writes are not data races.
+    The sequence counter is odd while a write is in progress: the reader copies the members and retries if the
+    counter was odd or was changed during the copy. Readers never write shared memory, so any count of readers
+    does not slow down each other or the writer.
+
+    Writers are serialized by the sequence counter itself, the readers are never blocked but may retry
+    while a write is in progress.
+    @note Only the described members are stored, `T` must be default constructible, the member types must be
+    scalars (preferably lock-free), arrays or described types.
+    @code
+    tmdesc::seqlock<quote> cache;
+    cache.modify([&](quote& q) { q.bid = bid; });  // writer
+    quote q = cache.load();                          // any count of readers
+    @endcode
+ */
+template <class T> class seqlock {
+    static_assert(detail::has_static_members<T>::value, "the type has no members description");
+
+public:
+    using value_type = T;
+
+    seqlock() noexcept = default;
+    explicit seqlock(const T& value) noexcept { data_.store(value); }
+    seqlock(const seqlock&) = delete;
+    seqlock& operator=(const seqlock&) = delete;
+
+    /// @return the consistent copy of the value, retries while the value is being written
+    /// @details The thread yields after a few failed attempts, in case the writer thread is preempted.
+    T load() const noexcept {
+        T result{};
+        for (std::size_t attempt = 1; !try_load(result); ++attempt) {
+            if (attempt % spins_before_yield == 0)
+                std::this_thread::yield();
+            else
+                detail::seqlock_pause();
+        }
+        return result;
+    }
+
+    /// Copies the value into `out` with a single attempt.
+    /// @return `true` if the copy is consistent, otherwise the content of `out` is unspecified
+    bool try_load(T& out) const noexcept {
+        const std::uint64_t before = sequence_.load(std::memory_order_acquire);
+        if (before & 1u)
+            return false;
+        data_.load(out);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return sequence_.load(std::memory_order_relaxed) == before;
+    }
+
+    /// Replaces the value
+    void store(const T& value) noexcept {
+        write_guard guard{sequence_, begin_write()};
+        data_.store(value);
+    }
+
+    /// Invokes `fn(T&)` with the current value and publishes the changed value.
+    /// @note The other writers are blocked while `fn` is invoked, so `fn` should be short.
+    /// If `fn` throws, the value is not changed.
+    template <class Fn> void modify(Fn&& fn) {
+        write_guard guard{sequence_, begin_write()};
+        T value{};
+        data_.load(value);
+        static_cast<Fn&&>(fn)(value);
+        data_.store(value);
+    }
+
+    /// @return count of completed writes
+    std::uint64_t version() const noexcept { return sequence_.load(std::memory_order_acquire) / 2; }
+
+private:
+    static constexpr std::size_t spins_before_yield = 64;
+
+    /// publishes the even counter at the end of the write
+    struct write_guard {
+        std::atomic<std::uint64_t>& sequence;
+        std::uint64_t started;
+        ~write_guard() { sequence.store(started + 2, std::memory_order_release); }
+    };
+
+    std::uint64_t begin_write() noexcept {
+        std::uint64_t sequence = sequence_.load(std::memory_order_relaxed);
+        for (std::size_t attempt = 0;;) {
+            if ((sequence & 1u) == 0 &&
+                sequence_.compare_exchange_weak(sequence, sequence + 1, std::memory_order_acquire,
+                                                std::memory_order_relaxed))
+                break;
+            if (++attempt % spins_before_yield == 0)
+                std::this_thread::yield();
+            else
+                detail::seqlock_pause();
+            sequence = sequence_.load(std::memory_order_relaxed);
+        }
+        // the member stores must not be visible before the odd counter
+        std::atomic_thread_fence(std::memory_order_release);
+        return sequence;
+    }
+
+    std::atomic<std::uint64_t> sequence_{0};
+    detail::seqlock_storage<T> data_;
+};
+template <class T> constexpr std::size_t seqlock<T>::spins_before_yield;
+
+} // namespace tmdesc
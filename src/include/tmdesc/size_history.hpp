@@ -0,0 +1,110 @@
+// Copyright Victor Smirnov 2021-2022
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+//
+// The documentation can be found at the library's page:
+// https://github.com/Ariox41/tmdesc
+
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace tmdesc {
+
+/** History of the encoded sizes of the type `T`, used to reserve the buffer capacity before encoding.
+
+    @details
+    Each thread collects the sizes in a thread-local window of @ref merge_period encodings, the maximum of the window
+    is merged into the shared estimate when the window is full. The shared estimate is a decaying maximum:
+    it grows to the maximum of the window at once and shrinks by 1/8 per window, so occasional large values
+    are not forgotten immediately. Recording does not synchronize with other threads, and the merge is a relaxed
+    load and store, because a lost update only makes the hint a bit less precise.
+    @code
+    std::string buffer;
+    tmdesc::reserve_expected<order>(buffer);
+    encode(buffer, value);
+    tmdesc::size_history<order>::record(buffer.size());
+    @endcode
+ */
+template <class T> class size_history {
+public:
+    /// count of the sizes recorded by a thread before the merge into the shared estimate
+    static constexpr std::size_t merge_period = 32;
+
+    /// records the encoded size of the value
+    static void record(std::size_t size) noexcept {
+        window& w = local();
+        w.max     = (std::max)(w.max, std::uint64_t(size));
+        if (++w.count < merge_period)
+            return;
+        const std::uint64_t current = shared().load(std::memory_order_relaxed);
+        shared().store((std::max)(w.max, current - current / 8), std::memory_order_relaxed);
+        w = window{};
+    }
+
+    /// @return the expected encoded size, or zero if nothing is recorded yet
+    static std::size_t expected() noexcept {
+        return std::size_t((std::max)(shared().load(std::memory_order_relaxed), local().max));
+    }
+
+private:
+    struct window {
+        std::size_t count = 0;
+        std::uint64_t max = 0;
+    };
+
+    static std::atomic<std::uint64_t>& shared() noexcept {
+        static std::atomic<std::uint64_t> estimate{0};
+        return estimate;
+    }
+    static window& local() noexcept {
+        static thread_local window w;
+        return w;
+    }
+};
+template <class T> constexpr std::size_t size_history<T>::merge_period;
+
+/// Reserves the capacity of the buffer for appending the value of the type `T` with the expected size.
+/// @details The buffer is any container with `size()`, `capacity()` and `reserve(n)`, like `std::string` or
+/// `std::vector<char>`. The capacity grows at least twice, so appending many values to the same buffer
+/// reallocates a logarithmic number of times, as `push_back` does; nothing is reserved if the free capacity
+/// is enough.
+template <class T, class Buffer> void reserve_expected(Buffer& buffer) {
+    const std::size_t expected = size_history<T>::expected();
+    if (buffer.capacity() - buffer.size() < expected)
+        buffer.reserve((std::max)(2 * buffer.capacity(), buffer.size() + expected));
+}
+
+/** Instrumentation policy which records the bytes reported by the call into the @ref size_history of the type.
+
+    @details
+    The policy is used like other instrumentation policies (see `instrumentation.hpp`): the encoder
+    reports the produced bytes by `scope::add_bytes`, and the sum is recorded when the scope is destroyed.
+ */
+struct size_tracking {
+    template <class T> class scope {
+    public:
+        scope() noexcept = default;
+        scope(const scope&) = delete;
+        scope& operator=(const scope&) = delete;
+        ~scope() { size_history<T>::record(bytes_); }
+
+        /// reports the count of produced bytes
+        void add_bytes(std::size_t count) noexcept { bytes_ += count; }
+
+    private:
+        std::size_t bytes_ = 0;
+    };
+};
+
+namespace detail {
+/// Prepares the output of the instrumented encoder: only @ref size_tracking knows the expected size of `T`
+template <class T, class Policy, class Buffer> void reserve_by_policy(Policy, Buffer&) noexcept {}
+template <class T, class Buffer> void reserve_by_policy(size_tracking, Buffer& buffer) {
+    reserve_expected<T>(buffer);
+}
+} // namespace detail
+
+} // namespace tmdesc
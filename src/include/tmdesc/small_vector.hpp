@@ -0,0 +1,263 @@
+// Copyright Victor Smirnov 2021-2022
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+//
+// The documentation can be found at the library's page:
+// https://github.com/Ariox41/tmdesc
+
+#pragma once
+#include "core/integral_constant.hpp"
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace tmdesc {
+
+/** Sequence container which stores up to `N` elements inside the object, the larger sequences are moved to the heap.
+
+    @details
+    The interface is the subset of `std::vector`. Decoders and @ref random_fill fill it like `std::vector`,
+    so the member of this type is decoded without allocation if the size does not exceed `N`:
+    @code
+    struct quote {
+        tmdesc::small_vector<level, 8> bids;
+
+        template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<quote, Impl> b) {
+            return b.type(b.members(b.member("bids", &quote::bids, b.attributes(b.max_size(8)))));
+        }
+    };
+    @endcode
+    The @ref tags::max_size attribute makes the decoders reject the larger sizes, see @ref check_max_sizes.
+    @note The move of the inline sequence moves the elements, the move of the heap sequence moves the pointer.
+ */
+template <class T, std::size_t N> class small_vector {
+    static_assert(N > 0, "the inline capacity must not be zero");
+
+public:
+    using value_type      = T;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference       = T&;
+    using const_reference = const T&;
+    using pointer         = T*;
+    using const_pointer   = const T*;
+    using iterator        = T*;
+    using const_iterator  = const T*;
+
+    /// count of elements stored inside the object
+    static constexpr std::size_t inline_capacity = N;
+
+    small_vector() noexcept
+      : data_(inline_data()) {}
+    explicit small_vector(std::size_t count)
+      : small_vector() {
+        resize(count);
+    }
+    small_vector(std::size_t count, const T& value)
+      : small_vector() {
+        resize(count, value);
+    }
+    small_vector(std::initializer_list<T> items)
+      : small_vector() {
+        assign(items.begin(), items.end());
+    }
+    small_vector(const small_vector& other)
+      : small_vector() {
+        assign(other.begin(), other.end());
+    }
+    small_vector(small_vector&& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+      : small_vector() {
+        take(other);
+    }
+    ~small_vector() {
+        clear();
+        release();
+    }
+
+    small_vector& operator=(const small_vector& other) {
+        if (this != &other)
+            assign(other.begin(), other.end());
+        return *this;
+    }
+    small_vector& operator=(small_vector&& other) noexcept(std::is_nothrow_move_constructible<T>::value) {
+        if (this != &other) {
+            clear();
+            release();
+            take(other);
+        }
+        return *this;
+    }
+
+    std::size_t size() const noexcept { return size_; }
+    std::size_t capacity() const noexcept { return capacity_; }
+    bool empty() const noexcept { return size_ == 0; }
+    /// @return `true` if the elements are stored inside the object
+    bool is_inline() const noexcept { return data_ == inline_data(); }
+
+    T* data() noexcept { return data_; }
+    const T* data() const noexcept { return data_; }
+    iterator begin() noexcept { return data_; }
+    const_iterator begin() const noexcept { return data_; }
+    iterator end() noexcept { return data_ + size_; }
+    const_iterator end() const noexcept { return data_ + size_; }
+
+    T& operator[](std::size_t i) noexcept { return data_[i]; }
+    const T& operator[](std::size_t i) const noexcept { return data_[i]; }
+    T& front() noexcept { return data_[0]; }
+    const T& front() const noexcept { return data_[0]; }
+    T& back() noexcept { return data_[size_ - 1]; }
+    const T& back() const noexcept { return data_[size_ - 1]; }
+
+    /// Moves the elements to the heap if `count` exceeds the capacity
+    void reserve(std::size_t count) {
+        if (count <= capacity_)
+            return;
+        std::allocator<T> allocator;
+        T* storage = allocator.allocate(count);
+        std::size_t moved = 0;
+        try {
+            for (; moved < size_; ++moved)
+                ::new (static_cast<void*>(storage + moved)) T(std::move_if_noexcept(data_[moved]));
+        } catch (...) {
+            destroy(storage, storage + moved);
+            allocator.deallocate(storage, count);
+            throw;
+        }
+        destroy(data_, data_ + size_);
+        release();
+        data_     = storage;
+        capacity_ = count;
+    }
+
+    /// Destroys the elements, the heap storage is kept
+    void clear() noexcept {
+        destroy(data_, data_ + size_);
+        size_ = 0;
+    }
+
+    template <class... Args> T& emplace_back(Args&&... args) {
+        if (size_ == capacity_) {
+            // the arguments may refer to the elements, so the element is created before the reallocation
+            T value(std::forward<Args>(args)...);
+            reserve(capacity_ * 2);
+            ::new (static_cast<void*>(data_ + size_)) T(std::move(value));
+        } else {
+            ::new (static_cast<void*>(data_ + size_)) T(std::forward<Args>(args)...);
+        }
+        return data_[size_++];
+    }
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+    void pop_back() noexcept { data_[--size_].~T(); }
+
+    /// Destroys the last elements or appends value-initialized elements
+    void resize(std::size_t count) {
+        resize_with(count, [](T* p, std::size_t) { ::new (static_cast<void*>(p)) T(); });
+    }
+    /// Destroys the last elements or appends copies of the `value`, the `value` may refer to the element
+    void resize(std::size_t count, const T& value) {
+        if (count > capacity_) {
+            // the reallocation moves the elements, so the value is copied before it
+            const T copy(value);
+            resize_with(count, [&copy](T* p, std::size_t) { ::new (static_cast<void*>(p)) T(copy); });
+            return;
+        }
+        resize_with(count, [&value](T* p, std::size_t) { ::new (static_cast<void*>(p)) T(value); });
+    }
+
+    /// Replaces the elements by the elements of the range, the range must not refer to the elements
+    template <class ForwardIt> void assign(ForwardIt first, ForwardIt last) {
+        clear();
+        const auto count = static_cast<std::size_t>(std::distance(first, last));
+        reserve(count);
+        construct_to(count, [&first](T* p, std::size_t) { ::new (static_cast<void*>(p)) T(*first++); });
+    }
+
+    friend bool operator==(const small_vector& lha, const small_vector& rha) {
+        if (lha.size() != rha.size())
+            return false;
+        for (std::size_t i = 0; i < lha.size(); ++i) {
+            if (!(lha[i] == rha[i]))
+                return false;
+        }
+        return true;
+    }
+    friend bool operator!=(const small_vector& lha, const small_vector& rha) { return !(lha == rha); }
+
+private:
+    T* inline_data() noexcept { return reinterpret_cast<T*>(&storage_); }
+    const T* inline_data() const noexcept { return reinterpret_cast<const T*>(&storage_); }
+
+    static void destroy(T* first, T* last) noexcept {
+        for (; first != last; ++first)
+            first->~T();
+    }
+
+    /// frees the heap storage, the elements must be destroyed
+    void release() noexcept {
+        if (!is_inline())
+            std::allocator<T>().deallocate(data_, capacity_);
+        data_     = inline_data();
+        capacity_ = N;
+    }
+
+    /// takes the elements of `other`, this sequence must be empty and inline
+    void take(small_vector& other) noexcept(std::is_nothrow_move_constructible<T>::value) {
+        if (other.is_inline()) {
+            construct_to(other.size_,
+                         [&other](T* p, std::size_t i) { ::new (static_cast<void*>(p)) T(std::move(other.data_[i])); });
+            other.clear();
+            return;
+        }
+        data_           = other.data_;
+        size_           = other.size_;
+        capacity_       = other.capacity_;
+        other.data_     = other.inline_data();
+        other.size_     = 0;
+        other.capacity_ = N;
+    }
+
+    template <class Construct> void resize_with(std::size_t count, Construct construct) {
+        if (count <= size_) {
+            destroy(data_ + count, data_ + size_);
+            size_ = count;
+            return;
+        }
+        if (count > capacity_)
+            reserve(count < capacity_ * 2 ? capacity_ * 2 : count);
+        construct_to(count, construct);
+    }
+
+    /// constructs the elements `[size(), count)` by `construct(address, index)`, the capacity must be enough
+    /// @details The loop does not update `size_`, the stores of `char` elements may alias it and prevent
+    /// the vectorization.
+    template <class Construct> void construct_to(std::size_t count, Construct construct) {
+        T* const data    = data_;
+        std::size_t size = size_;
+        try {
+            for (; size < count; ++size)
+                construct(data + size, size);
+        } catch (...) {
+            size_ = size;
+            throw;
+        }
+        size_ = count;
+    }
+
+    std::aligned_storage_t<sizeof(T) * N, alignof(T)> storage_;
+    T* data_;
+    std::size_t size_     = 0;
+    std::size_t capacity_ = N;
+};
+template <class T, std::size_t N> constexpr std::size_t small_vector<T, N>::inline_capacity;
+
+namespace detail {
+template <class T> struct is_small_vector : false_type {};
+template <class T, std::size_t N> struct is_small_vector<small_vector<T, N>> : true_type {};
+} // namespace detail
+
+} // namespace tmdesc
@@ -6,7 +6,10 @@
 // https://github.com/Ariox41/tmdesc
 
 #pragma once
+#include <cstddef>
 namespace tmdesc {
+template <class T> struct type_t;
+
 /** Attribute of type or type member.
 
     @tparam Key
@@ -24,6 +27,41 @@ namespace tags {
 /// Tag for typename attribute.
 /// The value ot attribute has type of @ref zstring_view
 struct type_name {};
+
+/// Tag for borrowed attribute.
+/// A member marked by it refers to the decoder input buffer instead of owning a copy of the decoded string.
+/// @see is_borrowed_member
+struct borrowed {};
+
+/// Tag for flags attribute.
+/// An enumeration marked by it is a set of single bit flags.
+/// @see is_flag_enum
+struct flags {};
+
+/// Tag for hot attribute.
+/// A member marked by it is accessed frequently, so it is stored in the hot part of the type,
+/// the members without it (or without @ref hot_write) are stored in the cold part.
+/// @see hot_part
+struct hot {};
+
+/// Tag for hot_write attribute.
+/// A member marked by it is written frequently, so it must not share the cache line with members of other
+/// cache line groups, nor with the members of its own group which are not marked by it.
+/// @see false_sharing_report_v
+struct hot_write {};
+
+/// Tag for cache_line_group attribute.
+/// The value of attribute has type of `std::size_t`, the members of the group are written by the same thread,
+/// so they must not share the cache line with members of other groups. The members without the attribute
+/// belong to the group 0.
+/// @see false_sharing_report_v
+struct cache_line_group {};
+
+/// Tag for max_size attribute.
+/// The value of attribute has type of `std::size_t`, it is the maximum size of the string or container member,
+/// the decoders reject larger values before allocating them.
+/// @see check_max_sizes
+struct max_size {};
 } // namespace tags
 
 /** Type info builder interface
@@ -103,11 +141,32 @@ public:
     template <class U> struct attribute_set;
     template <class U> struct member_info;
     template <class U> struct member_set_info;
+    template <class U> struct base_member_set_info;
+    template <class U> struct enumerator_info;
+    template <class U> struct enumerator_set_info;
     template <class U> struct type_info;
 
     /// wrap typename string to attribute
     constexpr attribute<tags::type_name, const char*> type_name(const char* name) const;
 
+    /// borrowed attribute for a member of string view type
+    constexpr attribute<tags::borrowed, bool> borrowed() const;
+
+    /// flags attribute for an enumeration of single bit flags
+    constexpr attribute<tags::flags, bool> flags() const;
+
+    /// hot attribute for a frequently accessed member
+    constexpr attribute<tags::hot, bool> hot() const;
+
+    /// hot_write attribute for a frequently written member
+    constexpr attribute<tags::hot_write, bool> hot_write() const;
+
+    /// cache_line_group attribute for a member written by the group of threads
+    constexpr attribute<tags::cache_line_group, std::size_t> cache_line_group(std::size_t group) const;
+
+    /// max_size attribute for a string or container member
+    constexpr attribute<tags::max_size, std::size_t> max_size(std::size_t size) const;
+
     /// wraps attributes to attribute_set
     template <class... Keys, class... Values>
     constexpr attribute_set<unspecified> attributes(attribute<Keys, Values>... attributes) const;
@@ -129,8 +188,23 @@ public:
     template <class M, class U, class... Args, class AS>
     constexpr void member(const char*, M (T::*)(Args...), attribute_set<AS> attributes_) const = delete;
 
+    /// wraps information about all members of the described base class `B`,
+    /// the result is used as an argument of the `members` function
+    template <class B> constexpr base_member_set_info<unspecified> base(type_t<B>) const;
+
     /// wraps information about member set to single struct
-    template <class... U> constexpr member_set_info<unspecified> members(member_info<U>... members_) const;
+    /// @details the arguments are the results of the `member` and `base` functions,
+    /// the members of bases are inserted in place with member pointers rebound to `T`.
+    template <class... U> constexpr member_set_info<unspecified> members(U... members_) const;
+
+    /// wraps information about an enumerator of enumeration T
+    /// @param name - enumerator name
+    /// @param value - enumerator value
+    constexpr enumerator_info<unspecified> enumerator(const char* name, T value) const;
+
+    /// wraps information about enumerator set to single struct
+    template <class... U>
+    constexpr enumerator_set_info<unspecified> enumerators(enumerator_info<U>... enumerators_) const;
 
     /// wraps information about type set to single struct
     /// @param member_set_ - type members info,  the result of the `members` function
@@ -145,6 +219,16 @@ public:
     /// @param attributes_ - type attributes, the result of the `attributes` function.
     template <class AS, class M>
     constexpr type_info<unspecified> type(attribute_set<AS> attributes_, member_set_info<M> member_set_) const;
+
+    /// wraps information about enumeration to single struct
+    /// @param enumerator_set_ - enumerators info, the result of the `enumerators` function
+    template <class E> constexpr type_info<unspecified> type(enumerator_set_info<E> enumerator_set_) const;
+
+    /// wraps information about enumeration to single struct
+    /// @param attributes_ - type attributes, the result of the `attributes` function.
+    /// @param enumerator_set_ - enumerators info, the result of the `enumerators` function
+    template <class AS, class E>
+    constexpr type_info<unspecified> type(attribute_set<AS> attributes_, enumerator_set_info<E> enumerator_set_) const;
 };
 
 } // namespace tmdesc
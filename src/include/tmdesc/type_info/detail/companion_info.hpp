@@ -0,0 +1,42 @@
+// Copyright Victor Smirnov 2021-2022
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+//
+// The documentation can be found at the library's page:
+// https://github.com/Ariox41/tmdesc
+
+#pragma once
+#include "../get_type_info.hpp"
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace tmdesc {
+namespace detail {
+/// Description of the member `I` of `T` for the member of type `M` of a companion type, like `atomic_struct<T>`.
+/// @details The companion member has the same name and attributes as the member of `T`,
+/// the getter returns the reference to the companion member.
+template <class M, class T, std::size_t I, class Getter> constexpr auto make_companion_getter_info(Getter getter) {
+    using attribute_type = std::decay_t<decltype(at_c<I>(static_type_members_v<T>.value()).attributes())>;
+    return member_info<M, Getter, attribute_type>{at_c<I>(static_type_members_v<T>.value()).name(),
+                                                  std::move(getter),
+                                                  at_c<I>(static_type_members_v<T>.value()).attributes()};
+}
+
+/// Description of the member `I` of `T` for the field `F::value` of the companion type `C`.
+/// @details The field is a base class of the companion, so the member pointer is converted to the member
+/// pointer of `C`.
+template <class C, class T, std::size_t I, class M, class F> constexpr auto make_companion_member_info(M F::*field) {
+    return make_companion_getter_info<M, T, I>(memptr_function_object<M, C>{field});
+}
+
+/// Description of the companion type `C` of `T` with the type attributes of `T`
+template <class T, class C, class Impl, class... MS>
+constexpr auto make_companion_type_info(info_builder<C, Impl> b, MS... members) {
+    using attribute_type = std::decay_t<decltype(static_type_attributes_v<T>.value())>;
+    return b.type(typename info_builder<C, Impl>::template attribute_set<attribute_type>{
+                      static_type_attributes_v<T>.value()},
+                  b.members(std::move(members)...));
+}
+} // namespace detail
+} // namespace tmdesc
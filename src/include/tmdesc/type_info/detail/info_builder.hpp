@@ -8,14 +8,16 @@
 #pragma once
 #include "../../string_view.hpp"
 #include "../../tmdesc_fwd.hpp"
+#include "../enumerator_info.hpp"
 #include "../member_info.hpp"
 #include "../type_info.hpp"
-#include <boost/hana/map.hpp>
-#include <boost/hana/optional.hpp>
-#include <boost/hana/tuple.hpp>
+#include "../../containers/dict.hpp"
+#include "../../containers/optional.hpp"
+#include "../../containers/tuple.hpp"
+#include "../../containers/tuple_cat.hpp"
+#include "../../core/type_t.hpp"
 namespace tmdesc {
 struct _default {};
-namespace hana = boost::hana;
 
 namespace detail {
 template <class M, class O> struct memptr_function_object {
@@ -23,6 +25,9 @@ template <class M, class O> struct memptr_function_object {
       : member_ptr_(member_ptr) {}
 
     using member_type = M;
+    using owner_type  = O;
+
+    constexpr M O::*member_pointer() const noexcept { return member_ptr_; }
 
     constexpr const M& operator()(const O& owner) const noexcept { return owner.*member_ptr_; }
     constexpr M& operator()(O& owner) const noexcept { return owner.*member_ptr_; }
@@ -32,6 +37,24 @@ template <class M, class O> struct memptr_function_object {
 private:
     M O::*member_ptr_ = nullptr;
 };
+
+template <class U> struct is_member_info : false_type {};
+template <class M, class G, class AS> struct is_member_info<member_info<M, G, AS>> : true_type {};
+
+/// Rebinds members of the base class `B` to the derived class `T`.
+/// The member pointer `M T::*` contains the offset in `T`, so the access does not adjust the pointer to the base.
+template <class T> struct rebind_base_members {
+    template <class M, class B, class AS>
+    static constexpr member_info<M, memptr_function_object<M, T>, AS>
+    rebind(const member_info<M, memptr_function_object<M, B>, AS>& mi) {
+        return {mi.name(), memptr_function_object<M, T>{static_cast<M T::*>(mi.getter().member_pointer())},
+                mi.attributes()};
+    }
+    template <class... MS>
+    constexpr tuple<decltype(rebind(std::declval<const MS&>()))...> operator()(const MS&... members) const {
+        return tuple<decltype(rebind(std::declval<const MS&>()))...>{rebind(members)...};
+    }
+};
 } // namespace detail
 
 template <class T> class info_builder<T, _default> {
@@ -44,15 +67,42 @@ public:
         using type = U;
         U members;
     };
+    template <class U> struct base_member_set_info {
+        using type = U;
+        U members;
+    };
+    template <class U> struct enumerator_set_info {
+        using type = U;
+        U enumerators;
+    };
 
     // wrap typename string to attribute
     constexpr attribute<tags::type_name, zstring_view> type_name(zstring_view name) const noexcept { return {name}; }
 
+    // mark member as a view into the decoder input buffer
+    constexpr attribute<tags::borrowed, bool> borrowed() const noexcept { return {true}; }
+
+    // mark enumeration as a set of single bit flags
+    constexpr attribute<tags::flags, bool> flags() const noexcept { return {true}; }
+
+    // mark member as frequently accessed
+    constexpr attribute<tags::hot, bool> hot() const noexcept { return {true}; }
+
+    // mark member as frequently written
+    constexpr attribute<tags::hot_write, bool> hot_write() const noexcept { return {true}; }
+
+    // assign member to the group of members written by the same thread
+    constexpr attribute<tags::cache_line_group, std::size_t> cache_line_group(std::size_t group) const noexcept {
+        return {group};
+    }
+
+    // limit the size of the string or container member
+    constexpr attribute<tags::max_size, std::size_t> max_size(std::size_t size) const noexcept { return {size}; }
+
     // wraps attributes to attribute_set
     template <class... KS, class... VS>
-    constexpr attribute_set<hana::map<hana::pair<hana::type<KS>, VS>...>>
-    attributes(attribute<KS, VS>... attributes) const {
-        return {hana::make_map(hana::make_pair(hana::type_c<KS>, attributes.value)...)};
+    constexpr attribute_set<dict<pair<KS, VS>...>> attributes(attribute<KS, VS>... attributes) const {
+        return {dict<pair<KS, VS>...>{std::move(attributes.value)...}};
     }
 
     // wraps information about a member
@@ -61,7 +111,8 @@ public:
     template <class M, class U> constexpr auto member(zstring_view name, M U::*member) const {
         static_assert(std::is_base_of<U, T>{}, "the member must be a pointer to member of T or its base class");
         M T::*real_memptr = member;
-        return detail::member_info<M, T, hana::map<>>{name, real_memptr, hana::map<>{}};
+        return member_info<M, detail::memptr_function_object<M, T>, dict<>>{
+            name, detail::memptr_function_object<M, T>{real_memptr}, dict<>{}};
     }
 
     // wraps information about a member
@@ -72,34 +123,89 @@ public:
     constexpr auto member(zstring_view name, M U::*member, attribute_set<AS> attributes_) const {
         static_assert(std::is_base_of<U, T>{}, "the member must be a pointer to member of T or its base class");
         M T::*real_memptr = member;
-        return member_info<M, T, AS>{name, real_memptr, std::move(attributes_.value)};
+        return member_info<M, detail::memptr_function_object<M, T>, AS>{
+            name, detail::memptr_function_object<M, T>{real_memptr}, std::move(attributes_.attributes)};
     }
 
+    // wraps information about all members of the described base class,
+    // the result is used as an argument of the `members` function
+    // @note defined in `get_type_info.hpp`, after `static_type_members_v`
+    template <class B> constexpr auto base(type_t<B>) const;
+
     // wraps information about member set to single struct
-    template <class... M, class... T, class... A>
-    constexpr member_set_info<hana::tuple<member_info<M, T, A>...>> members(member_info<M, T, A>... members_) const {
-        return {haba::make_tuple(std::move(members))};
+    template <class... MS, class... GS, class... AS>
+    constexpr member_set_info<tuple<member_info<MS, GS, AS>...>> members(member_info<MS, GS, AS>... members_) const {
+        return {tuple<member_info<MS, GS, AS>...>{std::move(members_)...}};
+    }
+
+    // wraps information about member set to single struct,
+    // the members of bases (the results of the `base` function) are inserted in place
+    template <class... Parts,
+              std::enable_if_t<!meta::fast_values_and_v<detail::is_member_info<Parts>...>, bool> = true>
+    constexpr auto members(Parts... parts) const {
+        using members_type = decltype(tuple_cat(member_part(std::move(parts))...));
+        return member_set_info<members_type>{tuple_cat(member_part(std::move(parts))...)};
+    }
+
+    // wraps information about an enumerator
+    // @param name - enumerator name
+    // @param value - enumerator value
+    constexpr enumerator_info<T> enumerator(zstring_view name, T value) const noexcept {
+        static_assert(std::is_enum<T>{}, "the enumerators can be described only for enumeration");
+        return {name, value};
+    }
+
+    // wraps information about enumerator set to single struct
+    template <class... ES>
+    constexpr enumerator_set_info<enumerator_list<T, sizeof...(ES)>> enumerators(ES... enumerators_) const noexcept {
+        static_assert(meta::fast_values_and_v<std::is_same<ES, enumerator_info<T>>...>,
+                      "the arguments must be the results of the `enumerator` function");
+        return {enumerator_list<T, sizeof...(ES)>{{enumerators_...}}};
     }
 
     // wraps information about type set to single struct
     // @param member_set_ - type members info,  the result of the `members` function
-    template <class M> constexpr type_info<hana::optional<M>, hana::map<>> type(member_set_info<M> member_set_) const {
-        return {hana::just(std::move(member_set_)), hana::map<>{}};
+    template <class M> constexpr auto type(member_set_info<M> member_set_) const {
+        return type_info<T, some_t<M>, dict<>>{some_t<M>{std::move(member_set_.members)}, dict<>{}};
     }
 
     // wraps information about type set to single struct
     // @param attributes_ - type attributes, the result of the `attributes` function.
-    template <class AS> constexpr type_info<hana::optional<>, AS> type(attribute_set<AS> attributes_) const {
-        return {hana::nothing, std::move(attributes_.value)};
+    template <class AS> constexpr auto type(attribute_set<AS> attributes_) const {
+        return type_info<T, none_t, AS>{none, std::move(attributes_.attributes)};
     }
 
     // wraps information about type set to single struct
     // @param member_set_ - type members info,  the result of the `members` function
     // @param attributes_ - type attributes, the result of the `attributes` function.
     template <class AS, class M>
-    constexpr type_info<hana::optional<M>, AS> type(attribute_set<AS> attributes_,
-                                                    member_set_info<M> member_set_) const noexcept {
-        return {hana::just(std::move(member_set_)), std::move(attributes_)};
+    constexpr auto type(attribute_set<AS> attributes_, member_set_info<M> member_set_) const {
+        return type_info<T, some_t<M>, AS>{some_t<M>{std::move(member_set_.members)},
+                                           std::move(attributes_.attributes)};
+    }
+
+private:
+    template <class M, class G, class AS>
+    static constexpr tuple<member_info<M, G, AS>> member_part(member_info<M, G, AS> member_) {
+        return tuple<member_info<M, G, AS>>{std::move(member_)};
+    }
+    template <class U> static constexpr U member_part(base_member_set_info<U> base_) { return std::move(base_.members); }
+
+public:
+
+    // wraps information about enumeration set to single struct
+    // @param enumerator_set_ - enumerators info, the result of the `enumerators` function
+    template <class E> constexpr auto type(enumerator_set_info<E> enumerator_set_) const {
+        return type_info<T, none_t, dict<>, some_t<E>>{none, dict<>{}, some_t<E>{enumerator_set_.enumerators}};
+    }
+
+    // wraps information about enumeration set to single struct
+    // @param attributes_ - type attributes, the result of the `attributes` function.
+    // @param enumerator_set_ - enumerators info, the result of the `enumerators` function
+    template <class AS, class E>
+    constexpr auto type(attribute_set<AS> attributes_, enumerator_set_info<E> enumerator_set_) const {
+        return type_info<T, none_t, AS, some_t<E>>{none, std::move(attributes_.attributes),
+                                                   some_t<E>{enumerator_set_.enumerators}};
     }
 };
 
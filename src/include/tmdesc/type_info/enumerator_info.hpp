@@ -0,0 +1,45 @@
+// Copyright Victor Smirnov 2021-2022
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+//
+// The documentation can be found at the library's page:
+// https://github.com/Ariox41/tmdesc
+#pragma once
+#include "../string_view.hpp"
+#include <cstddef>
+
+namespace tmdesc {
+
+/// Contains the name and the value of the enumerator.
+template <class E> struct enumerator_info {
+    using value_type = E;
+
+    constexpr enumerator_info() noexcept = default;
+    constexpr enumerator_info(zstring_view name, E value) noexcept
+      : name_(name)
+      , value_(value) {}
+
+    /// \return enumerator name.
+    constexpr zstring_view name() const noexcept { return name_; }
+
+    /// \return enumerator value.
+    constexpr E value() const noexcept { return value_; }
+
+private:
+    zstring_view name_;
+    E value_{};
+};
+
+/// Array of enumerators of the enumeration `E` in the order of the type description.
+/// @details All enumerators have the same type, so the array is used instead of the tuple.
+template <class E, std::size_t N> struct enumerator_list {
+    using value_type = enumerator_info<E>;
+
+    enumerator_info<E> items[N == 0 ? 1 : N];
+
+    static constexpr std::size_t size() noexcept { return N; }
+    constexpr const enumerator_info<E>& operator[](std::size_t i) const noexcept { return items[i]; }
+    constexpr const enumerator_info<E>* begin() const noexcept { return items; }
+    constexpr const enumerator_info<E>* end() const noexcept { return items + N; }
+};
+} // namespace tmdesc
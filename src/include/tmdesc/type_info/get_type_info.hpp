@@ -6,60 +6,87 @@
 // https://github.com/Ariox41/tmdesc
 
 #pragma once
+#include "../core/type_t.hpp"
 #include "detail/info_builder.hpp"
-#include <boost/hana/chain.hpp>
-#include <boost/hana/transform.hpp>
 namespace tmdesc {
 namespace detail {
 struct get_type_info_impl {
     template <class T>
-    constexpr auto operator()(hana::type<T>) const -> decltype(tmdesc_info(info_builder<T, _default>{})) {
-        return tmdesc_info(info_builder<T, _default>{});
+    constexpr auto operator()(type_t<T>, int) const -> some_t<decltype(tmdesc_info(info_builder<T, _default>{}))> {
+        return some(tmdesc_info(info_builder<T, _default>{}));
     }
+    template <class T> constexpr none_t operator()(type_t<T>, long) const noexcept { return none; }
 };
 constexpr get_type_info_impl get_type_info{};
 
 struct get_members_info_t {
-    template <class T> constexpr auto operator()(const T& type_info) const -> decltype(std::declval<T>().members()) {
-        return type_info.members();
+    template <class TI>
+    constexpr auto operator()(const some_t<TI>& type_info) const -> std::decay_t<decltype(type_info.value().members())> {
+        return type_info.value().members();
     }
+    constexpr none_t operator()(none_t) const noexcept { return none; }
 };
 constexpr get_members_info_t get_members_info{};
 
 struct get_attributes_t {
-    template <class T> constexpr auto operator()(const T& type_info) const -> decltype(std::declval<T>().attributes()) {
-        return type_info.attributes();
+    template <class TI>
+    constexpr auto operator()(const some_t<TI>& type_info) const
+        -> some_t<std::decay_t<decltype(type_info.value().attributes())>> {
+        return some(type_info.value().attributes());
     }
+    constexpr none_t operator()(none_t) const noexcept { return none; }
 };
 constexpr get_attributes_t get_attributes{};
 
+struct get_enumerators_info_t {
+    template <class TI>
+    constexpr auto operator()(const some_t<TI>& type_info) const
+        -> std::decay_t<decltype(type_info.value().enumerators())> {
+        return type_info.value().enumerators();
+    }
+    constexpr none_t operator()(none_t) const noexcept { return none; }
+};
+constexpr get_enumerators_info_t get_enumerators_info{};
+
 } // namespace detail
 
 /** Contains an optional value of type @ref type_info
 
     If the `tmdesc_info(info_builder<T, unspecified>)` free function is implemented for type T (see `tmdesc_fwd.hpp`),
-    then the value is `just(type_info<unspecified>{})`.
-    Otherwise, the value is `nothing`.
+    then the value is `some(type_info<unspecified>{})`.
+    Otherwise, the value is `none`.
 */
-template <class T>
-constexpr auto static_type_info_v = boost::hana::sfinae(detail::get_type_info)(boost::hana::type_c<T>);
+template <class T> constexpr auto static_type_info_v = detail::get_type_info(type_c<T>, 0);
 
 /** Contains an optional tuple of @ref member_info
 
     If the `tmdesc_info(info_builder<T, unspecified>)` free function is implemented for type T (see `tmdesc_fwd.hpp`),
-    and type description contains members set, then the value is `just(tupe<member_info<unspecified>...>{})`.
-    Otherwise, the value is `nothing`.
+    and type description contains members set, then the value is `some(tuple<member_info<unspecified>...>{})`.
+    Otherwise, the value is `none`.
 */
-template <class T>
-constexpr auto static_type_members_v = boost::hana::chain(static_type_info_v<T>, detail::get_members_info);
+template <class T> constexpr auto static_type_members_v = detail::get_members_info(static_type_info_v<T>);
+
+template <class T> template <class B> constexpr auto info_builder<T, _default>::base(type_t<B>) const {
+    static_assert(std::is_base_of<B, T>{}, "the type must be a base class of T");
+    static_assert(!decltype(is_none(static_type_members_v<B>))::value, "the base class has no members description");
+    using members_type = decltype(unpack(static_type_members_v<B>.value(), detail::rebind_base_members<T>{}));
+    return base_member_set_info<members_type>{unpack(static_type_members_v<B>.value(), detail::rebind_base_members<T>{})};
+}
 
-/** Contains an optional map of attributes.
+/** Contains an optional dict of attributes.
 
     If the `tmdesc_info(info_builder<T, unspecified>)` free function is implemented for type T (see `tmdesc_fwd.hpp`),
-    then the value is `just(map<pair<type<Tags>, Value>...>{})`.
-    Otherwise, the value is `nothing`.
+    then the value is `some(dict<pair<Tags, Values>...>{})`.
+    Otherwise, the value is `none`.
+ */
+template <class T> constexpr auto static_type_attributes_v = detail::get_attributes(static_type_info_v<T>);
+
+/** Contains an optional list of enumerators.
+
+    If the `tmdesc_info(info_builder<E, unspecified>)` free function is implemented for enumeration E,
+    and type description contains enumerators set, then the value is `some(enumerator_list<E, N>{})`.
+    Otherwise, the value is `none`.
  */
-template <class T>
-constexpr auto static_type_attributes_v = boost::hana::transform(static_type_info_v<T>, detail::get_attributes);
+template <class T> constexpr auto static_type_enumerators_v = detail::get_enumerators_info(static_type_info_v<T>);
 
 } // namespace tmdesc
@@ -0,0 +1,43 @@
+// Copyright Victor Smirnov 2021-2022
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+//
+// The documentation can be found at the library's page:
+// https://github.com/Ariox41/tmdesc
+
+#pragma once
+#include "../algorithm/unpack.hpp"
+#include "../containers/perfect_hash.hpp"
+#include "../string_view.hpp"
+#include "get_type_info.hpp"
+
+namespace tmdesc {
+namespace detail {
+template <class T>
+constexpr std::size_t members_count_v =
+    decltype(size(static_type_members_v<T>.value()))::value;
+
+struct make_member_names_t {
+    template <class... MemberInfos>
+    constexpr constexpr_array<string_view, sizeof...(MemberInfos)> operator()(const MemberInfos&... mi) const noexcept {
+        return {{mi.name()...}};
+    }
+};
+
+template <class T> struct member_name_index {
+    static constexpr constexpr_array<string_view, members_count_v<T>> names =
+        unpack(static_type_members_v<T>.value(), make_member_names_t{});
+    static constexpr perfect_hash<members_count_v<T>> value{names, 0};
+};
+template <class T>
+constexpr constexpr_array<string_view, members_count_v<T>> member_name_index<T>::names;
+template <class T> constexpr perfect_hash<members_count_v<T>> member_name_index<T>::value;
+} // namespace detail
+
+/// Returns the index of member with name `name` in the description of the type `T`, or `string_view::npos`.
+/// @details The lookup is O(1): it uses the perfect hash of member names, built at compile time.
+template <class T> constexpr std::size_t find_member_index(string_view name) noexcept {
+    return detail::member_name_index<T>::value.find(name);
+}
+
+} // namespace tmdesc
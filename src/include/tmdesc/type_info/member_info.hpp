@@ -6,7 +6,7 @@
 // https://github.com/Ariox41/tmdesc
 #pragma once
 #include "../string_view.hpp"
-#include <boost/hana/map.hpp>
+#include <utility>
 namespace tmdesc {
 
 /// Contains the name of the member,
@@ -24,9 +24,9 @@ template <class T, class Getter, class AS> struct member_info {
     constexpr zstring_view name() const noexcept { return member_name_; }
 
     /// \return functional object for getting a reference to the member from the owner object.
-    const Getter& getter() const noexcept { return getter_; }
+    constexpr const Getter& getter() const noexcept { return getter_; }
 
-    /// \return `map<pair<type<Tag>, Value>...>` of member attributes
+    /// \return `dict<pair<Tag, Value>...>` of member attributes
     constexpr const AS& attributes() const noexcept { return attributes_; }
 
 private:
@@ -4,8 +4,10 @@
 //
 // The documentation can be found at the library's page:
 // https://github.com/Ariox41/tmdesc
+#pragma once
+#include "../containers/optional.hpp"
 #include "../string_view.hpp"
-#include <boost/hana/optional.hpp>
+#include <utility>
 namespace tmdesc {
 
 /** Contains information about type T.
@@ -15,27 +17,40 @@ namespace tmdesc {
     of the attribute, value is an arbitrary value specified for this attribute.
     The set of attributes may be empty.
 
-    The set of members is represented as `nothing` or `just(tuple<member_info<unspecified>>{})`.
+    The set of members is represented as `none` or `some(tuple<member_info<unspecified>...>{})`.
     There is a difference between an empty list of members, and no list.
     For example, a structure with an empty list of members corresponds to the xml representation `<Struct Name />`.
     If the list of members is not specified, this structure cannot be serialized in xml.
     But another sterilization method can be specified in the type attributes.
+
+    The enumeration can provide the set of its enumerators instead of the members,
+    it is represented as `none` or `some(enumerator_list<T, N>{})`.
 */
-template <class T, class MS, class AS> struct type_info {
+template <class T, class MS, class AS, class ES = none_t> struct type_info {
     constexpr type_info(MS members, AS attributes)
       : members_(std::move(members))
       , attributes_(std::move(attributes)) {}
 
-    /// @return `just(tuple(members...)))` or `nothing`.
+    constexpr type_info(MS members, AS attributes, ES enumerators)
+      : members_(std::move(members))
+      , attributes_(std::move(attributes))
+      , enumerators_(std::move(enumerators)) {}
+
+    /// @return `some(tuple(members...)))` or `none`.
     /// @details the members is an optional tuple of @ref member_info objects.
     constexpr const MS& members() const noexcept { return members_; }
 
-    /// @return `map<pair<Tag, Value>...>` of type attributes.
+    /// @return `dict<pair<Tag, Value>...>` of type attributes.
     /// @note the optional default attribute has tag of @ref tags::type_name with value of type `zstring_view`.
     constexpr const AS& attributes() const noexcept { return attributes_; }
+
+    /// @return `some(enumerator_list<T, N>{})` or `none`.
+    /// @details the enumerators are described only for enumerations, see @ref enumerator_info.
+    constexpr const ES& enumerators() const noexcept { return enumerators_; }
 private:
     MS members_;
     AS attributes_;
+    ES enumerators_;
 };
 
 } // namespace tmdesc
@@ -0,0 +1,79 @@
+// Copyright Victor Smirnov 2021-2022
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+//
+// The documentation can be found at the library's page:
+// https://github.com/Ariox41/tmdesc
+
+#pragma once
+#include "functional/invoke.hpp"
+#include "instrumentation.hpp"
+#include "string_view.hpp"
+#include "type_info/member_index.hpp"
+#include <type_traits>
+#include <utility>
+
+namespace tmdesc {
+namespace detail {
+template <class Owner, class Visitor, class Indices> struct member_visit_table;
+
+template <class Owner, class Visitor, std::size_t... Is>
+struct member_visit_table<Owner, Visitor, std::index_sequence<Is...>> {
+    using owner_type = std::decay_t<Owner>;
+    using fn_type    = void (*)(Owner&&, Visitor&);
+
+    template <std::size_t I> static void visit(Owner&& owner, Visitor& visitor) {
+        invoke(visitor, at_c<I>(static_type_members_v<owner_type>.value()).getter()(
+                            static_cast<Owner&&>(owner)));
+    }
+
+    static constexpr fn_type table[sizeof...(Is) == 0 ? 1 : sizeof...(Is)] = {&visit<Is>...};
+};
+template <class Owner, class Visitor, std::size_t... Is>
+constexpr typename member_visit_table<Owner, Visitor, std::index_sequence<Is...>>::fn_type
+    member_visit_table<Owner, Visitor, std::index_sequence<Is...>>::table[];
+} // namespace detail
+
+/** Finds the member of `owner` by the runtime name and invokes `visitor` with the reference to the member.
+
+    @details
+    The member name is resolved in O(1) by the compile-time perfect hash of the type member names,
+    and the visitor is invoked through the table of per-member functions, without linear search.
+    The member reference qualifiers depend on the `owner` qualifiers.
+
+    @param owner - object of the described type
+    @param name - member name
+    @param visitor - invocable object overloaded for each member type, the invocation result is ignored.
+
+    @return `true` if the member is found and the visitor is invoked, `false` otherwise.
+
+    @see instrumented_visit_member_by_name
+ */
+#ifdef TMDESC_DOXYGEN
+constexpr auto visit_member_by_name = [](auto&& owner, string_view name, auto&& visitor) -> bool {};
+#else
+template <class Policy> struct instrumented_visit_member_by_name_t {
+    template <class Owner, class Visitor>
+    bool operator()(Owner&& owner, string_view name, Visitor&& visitor) const {
+        using owner_type = std::decay_t<Owner>;
+        using table_type =
+            detail::member_visit_table<Owner, Visitor, std::make_index_sequence<detail::members_count_v<owner_type>>>;
+
+        typename Policy::template scope<owner_type> instrumentation_scope;
+        (void)instrumentation_scope;
+        const std::size_t index = find_member_index<owner_type>(name);
+        if (index == string_view::npos)
+            return false;
+        table_type::table[index](static_cast<Owner&&>(owner), visitor);
+        return true;
+    }
+};
+using visit_member_by_name_t = instrumented_visit_member_by_name_t<no_instrumentation>;
+constexpr visit_member_by_name_t visit_member_by_name{};
+#endif
+
+/// @ref visit_member_by_name with the instrumentation policy, for example @ref counting_instrumentation.
+/// @details Each call is counted for the decayed owner type.
+template <class Policy> constexpr instrumented_visit_member_by_name_t<Policy> instrumented_visit_member_by_name{};
+
+} // namespace tmdesc
@@ -0,0 +1,99 @@
+#include "test_helpers.hpp"
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <tmdesc/algorithm/for_each.hpp>
+#include <tmdesc/atomic_struct.hpp>
+#include <tmdesc/members_view.hpp>
+#include <vector>
+
+namespace atomic_struct_test {
+struct traffic {
+    std::uint64_t bytes_in;
+    std::uint64_t bytes_out;
+
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<traffic, Impl> b) {
+        return b.type(b.members(b.member("bytes_in", &traffic::bytes_in), b.member("bytes_out", &traffic::bytes_out)));
+    }
+};
+
+struct stats {
+    std::uint64_t requests;
+    std::int32_t errors;
+    double last_latency;
+    traffic network;
+
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<stats, Impl> b) {
+        return b.type(b.attributes(b.type_name("stats")),
+                      b.members(b.member("requests", &stats::requests), //
+                                b.member("errors", &stats::errors, b.attributes(b.borrowed())),
+                                b.member("last_latency", &stats::last_latency), //
+                                b.member("network", &stats::network)));
+    }
+};
+
+using atomic_stats = tmdesc::atomic_struct<stats>;
+
+STATIC_CHECK(std::is_same<decltype(tmdesc::get_member<TMDESC_NAME("requests")>(std::declval<atomic_stats&>())),
+                          std::atomic<std::uint64_t>&>::value);
+STATIC_CHECK(std::is_same<decltype(tmdesc::get_member<TMDESC_NAME("network")>(std::declval<atomic_stats&>())),
+                          tmdesc::atomic_struct<traffic>&>::value);
+STATIC_CHECK(tmdesc::member_index_v<atomic_stats, TMDESC_NAME("last_latency")> == 2);
+STATIC_CHECK(tmdesc::at_key(tmdesc::static_type_attributes_v<atomic_stats>.value(),
+                            tmdesc::type_c<tmdesc::tags::type_name>) == "stats");
+
+struct collect_names {
+    std::string& out;
+    template <class M> void operator()(M member) const {
+        using attributes = std::decay_t<decltype(member.attributes())>;
+        out += member.name().c_str();
+        out += tmdesc::has_key<attributes, tmdesc::tags::borrowed>::value ? "* " : " ";
+    }
+};
+} // namespace atomic_struct_test
+
+TEST_CASE("atomic_struct") {
+    using namespace atomic_struct_test;
+    atomic_stats s(stats{1, 2, 0.5, {10, 20}});
+    CHECK(s.load().requests == 1);
+    CHECK(s.load().network.bytes_out == 20);
+
+    CHECK(s.fetch_add<TMDESC_NAME("requests")>(5) == 1);
+    CHECK(s.fetch_sub<TMDESC_NAME("errors")>(3) == 2);
+    tmdesc::get_member<TMDESC_NAME("last_latency")>(s).store(1.5);
+    tmdesc::get_member<TMDESC_NAME("network")>(s).fetch_add<TMDESC_NAME("bytes_in")>(1);
+
+    const stats snapshot = s.load(std::memory_order_relaxed);
+    CHECK(snapshot.requests == 6);
+    CHECK(snapshot.errors == -1);
+    CHECK(snapshot.last_latency == 1.5);
+    CHECK(snapshot.network.bytes_in == 11);
+    CHECK(snapshot.network.bytes_out == 20);
+
+    std::string names;
+    tmdesc::for_each(tmdesc::members_view(s), collect_names{names});
+    CHECK(names == "requests errors* last_latency network ");
+}
+
+TEST_CASE("atomic_struct concurrent counters") {
+    using namespace atomic_struct_test;
+    atomic_stats s;
+    CHECK(s.load().requests == 0);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&s] {
+            for (int i = 0; i < 10000; ++i) {
+                s.fetch_add<TMDESC_NAME("requests")>(1, std::memory_order_relaxed);
+                tmdesc::get_member<TMDESC_NAME("network")>(s).fetch_add<TMDESC_NAME("bytes_out")>(
+                    3, std::memory_order_relaxed);
+            }
+        });
+    }
+    for (auto& t : threads)
+        t.join();
+
+    CHECK(s.load().requests == 40000);
+    CHECK(s.load().network.bytes_out == 120000);
+}
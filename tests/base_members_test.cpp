@@ -0,0 +1,84 @@
+#include "test_helpers.hpp"
+#include <cstdint>
+#include <string>
+#include <tmdesc/algorithm/for_each.hpp>
+#include <tmdesc/member_name.hpp>
+#include <tmdesc/member_table.hpp>
+#include <tmdesc/members_view.hpp>
+
+namespace base_members_test {
+struct id_tag {};
+
+struct header {
+    std::uint64_t id;
+    std::int64_t timestamp;
+
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<header, Impl> b) {
+        return b.type(b.members(b.member("id", &header::id, b.attributes(tmdesc::attribute<id_tag, int>{1})),
+                                b.member("timestamp", &header::timestamp)));
+    }
+};
+
+struct padding {
+    char reserved[3];
+};
+
+struct routed : header {
+    int route;
+
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<routed, Impl> b) {
+        return b.type(b.members(b.base(tmdesc::type_c<header>), b.member("route", &routed::route)));
+    }
+};
+
+struct message : padding, routed {
+    std::string payload;
+
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<message, Impl> b) {
+        return b.type(b.members(b.member("payload", &message::payload), b.base(tmdesc::type_c<routed>)));
+    }
+};
+
+using message_members = std::decay_t<decltype(tmdesc::static_type_members_v<message>.value())>;
+STATIC_CHECK(decltype(tmdesc::size(std::declval<message_members>()))::value == 4);
+STATIC_CHECK(tmdesc::at_c<0>(tmdesc::static_type_members_v<message>.value()).name() == "payload");
+STATIC_CHECK(tmdesc::at_c<1>(tmdesc::static_type_members_v<message>.value()).name() == "id");
+STATIC_CHECK(tmdesc::at_c<3>(tmdesc::static_type_members_v<message>.value()).name() == "route");
+STATIC_CHECK(std::is_same<decltype(tmdesc::at_c<2>(tmdesc::static_type_members_v<message>.value()).getter()
+                                       .member_pointer()),
+                          std::int64_t message::*>::value);
+STATIC_CHECK(tmdesc::member_index_v<message, TMDESC_NAME("timestamp")> == 2);
+STATIC_CHECK(decltype(tmdesc::contains(tmdesc::at_c<1>(tmdesc::static_type_members_v<message>.value()).attributes(),
+                                       tmdesc::type_c<id_tag>))::value);
+
+constexpr std::int64_t stamped(std::int64_t ts) {
+    routed r{};
+    tmdesc::get_member<TMDESC_NAME("timestamp")>(r) = ts;
+    return r.timestamp;
+}
+STATIC_CHECK(stamped(42) == 42);
+} // namespace base_members_test
+
+TEST_CASE("members of base classes") {
+    using namespace base_members_test;
+    message m{};
+    m.id        = 7;
+    m.timestamp = 100;
+    m.route     = 3;
+    m.payload   = "data";
+
+    std::string names;
+    tmdesc::for_each(tmdesc::members_view(m), [&](auto member) {
+        names += member.name().c_str();
+        names += ';';
+    });
+    CHECK(names == "payload;id;timestamp;route;");
+
+    const tmdesc::member_table& table = tmdesc::member_table_of<message>();
+    REQUIRE(table.size() == 4);
+    CHECK(table[1].address(&m) == &m.id);
+    CHECK(table[2].address(&m) == &m.timestamp);
+    CHECK(table[3].address(&m) == &m.route);
+    CHECK(table[0].address(&m) == &m.payload);
+    CHECK(tmdesc::get_member<TMDESC_NAME("route")>(m) == 3);
+}
@@ -0,0 +1,55 @@
+#include "test_helpers.hpp"
+#include <string>
+#include <tmdesc/borrowed.hpp>
+
+namespace borrowed_test {
+struct custom_view {
+    const char* data;
+    std::size_t size;
+    constexpr custom_view(const char* data_, std::size_t size_) noexcept
+      : data(data_)
+      , size(size_) {}
+};
+
+struct request {
+    tmdesc::string_view path;
+    std::string body;
+    custom_view token;
+    tmdesc::zstring_view method;
+
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<request, Impl> b) {
+        return b.type(b.members(b.member("path", &request::path),                           //
+                                b.member("body", &request::body),                           //
+                                b.member("token", &request::token, b.attributes(b.borrowed())), //
+                                b.member("method", &request::method)));
+    }
+};
+
+template <std::size_t I>
+using member_info_at = std::decay_t<decltype(tmdesc::at_c<I>(tmdesc::static_type_members_v<request>.value()))>;
+
+static_assert(tmdesc::is_borrowed_string_v<tmdesc::string_view>, "");
+static_assert(!tmdesc::is_borrowed_string_v<tmdesc::zstring_view>, "");
+static_assert(!tmdesc::is_borrowed_string_v<std::string>, "");
+
+static_assert(tmdesc::is_borrowed_member_v<member_info_at<0>>, "string_view is borrowed by default");
+static_assert(!tmdesc::is_borrowed_member_v<member_info_at<1>>, "std::string is copied");
+static_assert(tmdesc::is_borrowed_member_v<member_info_at<2>>, "borrowed attribute");
+static_assert(!tmdesc::is_borrowed_member_v<member_info_at<3>>, "zstring_view requires the null terminator");
+} // namespace borrowed_test
+
+TEST_CASE("borrowed member refers to the input buffer") {
+    using namespace borrowed_test;
+    const std::string input = "/index.html;secret";
+    request r{{}, {}, {nullptr, 0}, "GET"};
+
+    constexpr auto& members = tmdesc::static_type_members_v<request>.value();
+    tmdesc::string_view src(input.data(), 11);
+    tmdesc::at_c<0>(members).getter()(r) = tmdesc::string_view(src.data(), src.size());
+    tmdesc::at_c<1>(members).getter()(r) = src.into<std::string>();
+
+    CHECK(r.path.data() == input.data());
+    CHECK(r.path == "/index.html");
+    CHECK(r.body.data() != input.data());
+    CHECK(r.body == "/index.html");
+}
@@ -0,0 +1,144 @@
+#include "test_helpers.hpp"
+#include <cstdint>
+#include <tmdesc/cache_layout.hpp>
+#include <tmdesc/member_name.hpp>
+
+namespace cache_layout_test {
+struct counters {
+    std::uint64_t produced;
+    std::uint64_t consumed;
+    std::uint32_t capacity;
+
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<counters, Impl> b) {
+        return b.type(b.members(b.member("produced", &counters::produced, b.attributes(b.cache_line_group(1))),
+                                b.member("consumed", &counters::consumed, b.attributes(b.cache_line_group(2))),
+                                b.member("capacity", &counters::capacity)));
+    }
+};
+
+struct padded_counters {
+    alignas(tmdesc::cache_line_size) std::uint64_t produced;
+    alignas(tmdesc::cache_line_size) std::uint64_t consumed;
+    alignas(tmdesc::cache_line_size) std::uint32_t capacity;
+
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<padded_counters, Impl> b) {
+        return b.type(b.members(b.member("produced", &padded_counters::produced, b.attributes(b.cache_line_group(1))),
+                                b.member("consumed", &padded_counters::consumed, b.attributes(b.cache_line_group(2))),
+                                b.member("capacity", &padded_counters::capacity)));
+    }
+};
+
+/// the hot counter shares the cache line with the read-mostly limit of the same group
+struct session {
+    std::uint64_t limit;
+    std::uint64_t sent;
+    char tail[80];
+
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<session, Impl> b) {
+        return b.type(b.members(b.member("limit", &session::limit),
+                                b.member("sent", &session::sent, b.attributes(b.hot_write())),
+                                b.member("tail", &session::tail)));
+    }
+};
+
+/// the over-aligned member hides the conflict of `a` and `b` if the offsets are guessed with `alignas` of groups
+struct over_aligned {
+    std::uint64_t a;
+    std::uint64_t b;
+    alignas(tmdesc::cache_line_size) std::uint64_t c;
+
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<over_aligned, Impl> b) {
+        return b.type(b.members(b.member("a", &over_aligned::a, b.attributes(b.cache_line_group(1))),
+                                b.member("b", &over_aligned::b, b.attributes(b.cache_line_group(2))),
+                                b.member("c", &over_aligned::c, b.attributes(b.cache_line_group(2)))));
+    }
+};
+
+/// the member `hidden` is not described, so the offsets can not be calculated
+struct partial {
+    int visible;
+    int hidden;
+
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<partial, Impl> b) {
+        return b.type(b.members(b.member("visible", &partial::visible)));
+    }
+};
+
+/// described out of the declaration order: the calculated layout matches `sizeof`, but the offsets are wrong
+struct out_of_order {
+    std::uint64_t a;
+    std::uint64_t c;
+    std::uint64_t b[7];
+
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<out_of_order, Impl> b) {
+        return b.type(b.members(b.member("a", &out_of_order::a, b.attributes(b.cache_line_group(1))),
+                                b.member("b", &out_of_order::b, b.attributes(b.cache_line_group(1))),
+                                b.member("c", &out_of_order::c, b.attributes(b.cache_line_group(2)))));
+    }
+};
+
+constexpr tmdesc::false_sharing_report counters_report = tmdesc::false_sharing_report_v<counters>;
+STATIC_CHECK(counters_report.layout_known);
+STATIC_CHECK(!counters_report.layout_verified);
+STATIC_CHECK(counters_report.conflicts == 3);
+STATIC_CHECK(counters_report.first == "produced");
+STATIC_CHECK(counters_report.second == "consumed");
+STATIC_CHECK(!counters_report.ok());
+
+STATIC_CHECK(!tmdesc::false_sharing_report_v<padded_counters>.layout_known);
+STATIC_CHECK(!tmdesc::false_sharing_report_v<over_aligned>.layout_known);
+
+constexpr tmdesc::false_sharing_report session_report = tmdesc::false_sharing_report_v<session>;
+STATIC_CHECK(session_report.conflicts == 2);
+STATIC_CHECK(session_report.first == "limit");
+STATIC_CHECK(session_report.second == "sent");
+
+STATIC_CHECK(!tmdesc::false_sharing_report_v<partial>.layout_known);
+
+// the calculated layout has no conflicts, but the compile-time report is not a proof
+constexpr tmdesc::false_sharing_report out_of_order_report = tmdesc::false_sharing_report_v<out_of_order>;
+STATIC_CHECK(out_of_order_report.layout_known);
+STATIC_CHECK(out_of_order_report.conflicts == 0);
+STATIC_CHECK(!out_of_order_report.ok());
+
+using padded = tmdesc::padded_layout<counters>;
+STATIC_CHECK(alignof(padded) == tmdesc::cache_line_size);
+STATIC_CHECK(sizeof(padded) == 3 * tmdesc::cache_line_size);
+STATIC_CHECK(tmdesc::member_index_v<padded, TMDESC_NAME("consumed")> == 1);
+} // namespace cache_layout_test
+
+TEST_CASE("false sharing audit") {
+    using namespace cache_layout_test;
+    const tmdesc::false_sharing_report report = tmdesc::audit_false_sharing<counters>();
+    CHECK(report.conflicts == counters_report.conflicts);
+    CHECK(report.first == "produced");
+
+    CHECK(tmdesc::audit_false_sharing<padded_counters>().ok());
+
+    const tmdesc::false_sharing_report over_aligned_report = tmdesc::audit_false_sharing<over_aligned>();
+    CHECK(over_aligned_report.conflicts == 1);
+    CHECK(over_aligned_report.first == "a");
+    CHECK(over_aligned_report.second == "b");
+    CHECK(tmdesc::audit_false_sharing<partial>().ok());
+
+    const tmdesc::false_sharing_report out_of_order_audit = tmdesc::audit_false_sharing<out_of_order>();
+    CHECK(out_of_order_audit.layout_verified);
+    CHECK(out_of_order_audit.conflicts == 2);
+    CHECK(out_of_order_audit.first == "a");
+    CHECK(out_of_order_audit.second == "c");
+    CHECK(tmdesc::audit_false_sharing<tmdesc::padded_layout<counters>>().ok());
+    CHECK(tmdesc::audit_false_sharing<tmdesc::padded_layout<session>>().ok());
+}
+
+TEST_CASE("padded_layout") {
+    using namespace cache_layout_test;
+    tmdesc::padded_layout<counters> p(counters{1, 2, 3});
+    tmdesc::get_member<TMDESC_NAME("consumed")>(p) += 5;
+    const counters c = p.unpadded();
+    CHECK(c.produced == 1);
+    CHECK(c.consumed == 7);
+    CHECK(c.capacity == 3);
+
+    p.assign(counters{4, 5, 6});
+    CHECK(p.unpadded().capacity == 6);
+}
@@ -0,0 +1,67 @@
+#include "../test_helpers.hpp"
+#include <string>
+#include <tmdesc/containers/dict.hpp>
+#include <tmdesc/string_view.hpp>
+
+namespace dict_test {
+struct id_tag {};
+struct name_tag {};
+struct flag_tag {};
+struct missing_tag {};
+struct empty_value {};
+
+using test_dict = tmdesc::dict<tmdesc::pair<id_tag, int>, tmdesc::pair<name_tag, tmdesc::zstring_view>,
+                               tmdesc::pair<flag_tag, empty_value>>;
+
+constexpr test_dict d{42, "name", empty_value{}};
+
+struct is_name_or_flag {
+    template <class K>
+    constexpr tmdesc::bool_constant<std::is_same<K, name_tag>::value || std::is_same<K, flag_tag>::value>
+    operator()(tmdesc::type_t<K>) const noexcept {
+        return {};
+    }
+};
+struct never {
+    template <class K> constexpr tmdesc::false_type operator()(tmdesc::type_t<K>) const noexcept { return {}; }
+};
+
+STATIC_CHECK(tmdesc::has_key_v<test_dict, id_tag>);
+STATIC_CHECK(tmdesc::has_key_v<const test_dict&, flag_tag>);
+STATIC_CHECK(!tmdesc::has_key_v<test_dict, missing_tag>);
+STATIC_CHECK(std::is_empty<tmdesc::dict<tmdesc::pair<flag_tag, empty_value>>>::value);
+
+STATIC_NOTHROW_CHECK(tmdesc::at_key(d, tmdesc::type_c<id_tag>) == 42);
+STATIC_NOTHROW_CHECK(tmdesc::at_key(d, tmdesc::type_c<name_tag>) == "name");
+
+STATIC_CHECK(decltype(tmdesc::contains(d, tmdesc::type_c<name_tag>))::value);
+STATIC_CHECK(!decltype(tmdesc::contains(d, tmdesc::type_c<missing_tag>))::value);
+STATIC_CHECK(!decltype(tmdesc::contains(tmdesc::dict<>{}, tmdesc::type_c<id_tag>))::value);
+
+STATIC_NOTHROW_CHECK(tmdesc::find(d, tmdesc::type_c<id_tag>).value() == 42);
+STATIC_CHECK(std::is_same<decltype(tmdesc::find(d, tmdesc::type_c<id_tag>)), tmdesc::some_t<const int&>>::value);
+STATIC_CHECK(std::is_same<decltype(tmdesc::find(test_dict{}, tmdesc::type_c<id_tag>)), tmdesc::some_t<int>>::value);
+STATIC_CHECK(std::is_same<decltype(tmdesc::find(d, tmdesc::type_c<missing_tag>)), tmdesc::none_t>::value);
+
+STATIC_NOTHROW_CHECK(tmdesc::find_if(d, is_name_or_flag{}).value() == "name");
+STATIC_CHECK(std::is_same<decltype(tmdesc::find_if(d, never{})), tmdesc::none_t>::value);
+STATIC_CHECK(std::is_same<decltype(tmdesc::find_if(tmdesc::dict<>{}, never{})), tmdesc::none_t>::value);
+} // namespace dict_test
+
+TEST_CASE("dict") {
+    using namespace dict_test;
+    using mutable_dict_t = tmdesc::dict<tmdesc::pair<id_tag, int>, tmdesc::pair<name_tag, std::string>>;
+
+    SUBCASE("modification by reference") {
+        mutable_dict_t mutable_dict{1, "first"};
+        tmdesc::at_key(mutable_dict, tmdesc::type_c<id_tag>) = 2;
+        tmdesc::find(mutable_dict, tmdesc::type_c<name_tag>).value() += "_second";
+        CHECK(tmdesc::at_key(mutable_dict, tmdesc::type_c<id_tag>) == 2);
+        CHECK(tmdesc::at_key(mutable_dict, tmdesc::type_c<name_tag>) == "first_second");
+    }
+    SUBCASE("move from rvalue") {
+        mutable_dict_t mutable_dict{1, "first"};
+        auto name = tmdesc::find(std::move(mutable_dict), tmdesc::type_c<name_tag>);
+        CHECK(name.value() == "first");
+    }
+}
@@ -0,0 +1,59 @@
+#include "../test_helpers.hpp"
+
+#include <memory>
+#include <string>
+#include <tmdesc/containers/tuple_cat.hpp>
+
+TEST_CASE("tuple_cat") {
+    SUBCASE("empty tuples") {
+        constexpr auto t = tmdesc::tuple_cat();
+        STATIC_CHECK(std::is_same<decltype(t), const tmdesc::tuple<>>{});
+        constexpr auto t2 = tmdesc::tuple_cat(tmdesc::tuple<>{}, tmdesc::tuple<>{});
+        STATIC_CHECK(std::is_same<decltype(t2), const tmdesc::tuple<>>{});
+    }
+    SUBCASE("constexpr concatenation") {
+        static constexpr tmdesc::tuple<int, char> t1{1, '2'};
+        static constexpr tmdesc::tuple<> t2{};
+        static constexpr tmdesc::tuple<long> t3{3};
+        static constexpr auto t = tmdesc::tuple_cat(t1, t2, t3, t1);
+        STATIC_CHECK(std::is_same<decltype(t), const tmdesc::tuple<int, char, long, int, char>>{});
+        STATIC_NOTHROW_CHECK(tmdesc::at_c<0>(t) == 1);
+        STATIC_NOTHROW_CHECK(tmdesc::at_c<1>(t) == '2');
+        STATIC_NOTHROW_CHECK(tmdesc::at_c<2>(t) == 3);
+        STATIC_NOTHROW_CHECK(tmdesc::at_c<3>(t) == 1);
+        STATIC_NOTHROW_CHECK(tmdesc::at_c<4>(t) == '2');
+        STATIC_CHECK(noexcept(tmdesc::tuple_cat(t1, t2, t3)));
+    }
+    SUBCASE("references are kept") {
+        int a = 1;
+        int b = 2;
+        auto t = tmdesc::tuple_cat(tmdesc::tuple<int&>{a}, tmdesc::tuple<const int&, int>{b, 3});
+        STATIC_CHECK(std::is_same<decltype(t), tmdesc::tuple<int&, const int&, int>>{});
+        tmdesc::at_c<0>(t) = 10;
+        b                  = 20;
+        REQUIRE(a == 10);
+        REQUIRE(tmdesc::at_c<1>(t) == 20);
+        REQUIRE(tmdesc::at_c<2>(t) == 3);
+    }
+    SUBCASE("elements of rvalue tuples are moved") {
+        tmdesc::tuple<std::unique_ptr<int>, std::string> t1{std::make_unique<int>(42), "str"};
+        tmdesc::tuple<std::string> t2{"copied"};
+        auto t = tmdesc::tuple_cat(std::move(t1), t2);
+        STATIC_CHECK(!noexcept(tmdesc::tuple_cat(std::move(t1), t2)));
+        REQUIRE(*tmdesc::at_c<0>(t) == 42);
+        REQUIRE(tmdesc::at_c<0>(t1) == nullptr);
+        REQUIRE(tmdesc::at_c<1>(t) == "str");
+        REQUIRE(tmdesc::at_c<2>(t) == "copied");
+        REQUIRE(tmdesc::at_c<0>(t2) == "copied");
+    }
+    SUBCASE("flatten") {
+        static constexpr auto nested = tmdesc::make_tuple(tmdesc::make_tuple(1, 2), tmdesc::tuple<>{},
+                                                          tmdesc::make_tuple('3'), tmdesc::make_tuple(4u, 5l, 6ll));
+        static constexpr auto t      = tmdesc::flatten(nested);
+        STATIC_CHECK(std::is_same<decltype(t), const tmdesc::tuple<int, int, char, unsigned, long, long long>>{});
+        STATIC_NOTHROW_CHECK(tmdesc::at_c<0>(t) == 1);
+        STATIC_NOTHROW_CHECK(tmdesc::at_c<2>(t) == '3');
+        STATIC_NOTHROW_CHECK(tmdesc::at_c<5>(t) == 6);
+        STATIC_CHECK(std::is_same<decltype(tmdesc::flatten(tmdesc::tuple<>{})), tmdesc::tuple<>>{});
+    }
+}
@@ -138,6 +138,43 @@ TEST_CASE("tuple initialisation and get") {
     }
 }
 
+namespace tuple_test {
+struct is_integral {
+    template <class T> constexpr std::is_integral<T> operator()(tmdesc::type_t<T>) const noexcept { return {}; }
+};
+struct is_int {
+    template <class T> constexpr bool operator()(tmdesc::type_t<T>) const noexcept {
+        return std::is_same<T, int>::value;
+    }
+};
+} // namespace tuple_test
+
+TEST_CASE("tuple search") {
+    using tuple_test::is_integral;
+    static constexpr tmdesc::tuple<tmdesc::zstring_view, long, int> t{"str", 1, 2};
+    STATIC_NOTHROW_CHECK(tmdesc::find_if(t, is_integral{}).value() == 1);
+    STATIC_CHECK(std::is_same<decltype(tmdesc::find_if(t, is_integral{})), tmdesc::some_t<const long&>>::value);
+    STATIC_NOTHROW_CHECK(tmdesc::find(t, tmdesc::type_c<int>).value() == 2);
+    STATIC_NOTHROW_CHECK(tmdesc::find_if(t, tuple_test::is_int{}).value() == 2);
+    STATIC_CHECK(std::is_same<decltype(tmdesc::find(t, tmdesc::type_c<char>)), tmdesc::none_t>::value);
+    STATIC_CHECK(std::is_same<decltype(tmdesc::find_if(tmdesc::tuple<>{}, is_integral{})), tmdesc::none_t>::value);
+    STATIC_CHECK(decltype(tmdesc::contains(t, tmdesc::type_c<long>))::value);
+
+    // the lambda is not default-constructible, the constant result is taken from its type
+    const auto is_int_lambda = [](auto type) { return std::is_same<typename decltype(type)::type, int>{}; };
+    CHECK(tmdesc::find_if(t, is_int_lambda).value() == 2);
+    STATIC_CHECK(std::is_same<decltype(tmdesc::find_if(t, is_int_lambda)), tmdesc::some_t<const int&>>::value);
+
+    tmdesc::tuple<std::string, std::unique_ptr<int>> mutable_tuple{"str", std::make_unique<int>(42)};
+    tmdesc::find(mutable_tuple, tmdesc::type_c<std::string>).value() += "_second";
+    REQUIRE(tmdesc::at_c<0>(mutable_tuple) == "str_second");
+
+    auto moved = tmdesc::find(std::move(mutable_tuple), tmdesc::type_c<std::unique_ptr<int>>);
+    static_assert(std::is_same<decltype(moved), tmdesc::some_t<std::unique_ptr<int>>>::value, "");
+    REQUIRE(*moved.value() == 42);
+    REQUIRE(tmdesc::at_c<1>(mutable_tuple) == nullptr);
+}
+
 //TEST_CASE("tuple operations") {
 //    SUBCASE("empty tuple") {
 //        constexpr tmdesc::tuple<> t1;
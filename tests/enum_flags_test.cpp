@@ -0,0 +1,76 @@
+#include "test_helpers.hpp"
+#include <cstdint>
+#include <string>
+#include <tmdesc/enum_flags.hpp>
+
+namespace enum_flags_test {
+enum class permission : std::uint8_t { none = 0, read = 1, write = 2, execute = 4, admin = 128 };
+template <class Impl> constexpr auto tmdesc_info(tmdesc::info_builder<permission, Impl> b) {
+    return b.type(b.attributes(b.flags()), b.enumerators(b.enumerator("none", permission::none),
+                                                         b.enumerator("read", permission::read),
+                                                         b.enumerator("write", permission::write),
+                                                         b.enumerator("execute", permission::execute),
+                                                         b.enumerator("admin", permission::admin)));
+}
+constexpr permission operator|(permission l, permission r) noexcept {
+    return static_cast<permission>(static_cast<std::uint8_t>(l) | static_cast<std::uint8_t>(r));
+}
+
+enum feature : std::uint64_t { fast_path = 1ull << 10, big_pages = 1ull << 63 };
+template <class Impl> constexpr auto tmdesc_info(tmdesc::info_builder<feature, Impl> b) {
+    return b.type(b.attributes(b.flags()), b.enumerators(b.enumerator("fast_path", fast_path),
+                                                         b.enumerator("big_pages", big_pages)));
+}
+
+// the user overload found by ADL must not replace the described conversion
+inline std::string to_string(permission) { return "user"; }
+
+enum class color { red, green };
+template <class Impl> constexpr auto tmdesc_info(tmdesc::info_builder<color, Impl> b) {
+    return b.type(b.enumerators(b.enumerator("red", color::red), b.enumerator("green", color::green)));
+}
+
+STATIC_CHECK(tmdesc::is_flag_enum_v<permission>);
+STATIC_CHECK(tmdesc::is_flag_enum_v<feature>);
+STATIC_CHECK(!tmdesc::is_flag_enum_v<color>);
+STATIC_CHECK(!tmdesc::is_flag_enum_v<int>);
+
+STATIC_CHECK(tmdesc::pack_flags(permission::read | permission::admin) == 0b10000001);
+STATIC_CHECK(tmdesc::pack_flags(permission::none) == 0);
+STATIC_CHECK(tmdesc::pack_flags(static_cast<permission>(8)) == 0);
+STATIC_CHECK(tmdesc::unpack_flags<permission>(0b10000001) == (permission::read | permission::admin));
+STATIC_CHECK(tmdesc::unpack_flags<permission>(0x1ff) == static_cast<permission>(0b10000111));
+STATIC_CHECK(tmdesc::pack_flags(static_cast<feature>(fast_path | big_pages)) == (fast_path | big_pages));
+STATIC_CHECK(tmdesc::unpack_flags<feature>(1ull << 63) == big_pages);
+
+constexpr permission parsed(tmdesc::string_view text) {
+    permission result = permission::admin;
+    tmdesc::flags_from_string(text, result);
+    return result;
+}
+STATIC_CHECK(parsed("read|write") == (permission::read | permission::write));
+STATIC_CHECK(parsed(" execute | read ") == (permission::read | permission::execute));
+STATIC_CHECK(parsed("") == permission::none);
+STATIC_CHECK(parsed("read|unknown") == permission::admin);
+} // namespace enum_flags_test
+
+TEST_CASE("flag enum text encoding") {
+    using namespace enum_flags_test;
+    CHECK(tmdesc::flags_to_string(permission::read | permission::write | permission::admin) == "read|write|admin");
+    CHECK(tmdesc::flags_to_string(permission::none) == "none");
+    CHECK(tmdesc::flags_to_string(static_cast<permission>(8)) == "none");
+    CHECK(tmdesc::flags_to_string(static_cast<feature>(0)) == "");
+    CHECK(tmdesc::flags_to_string(big_pages) == "big_pages");
+
+    std::string out = "flags=";
+    tmdesc::append_flags(permission::execute, out);
+    CHECK(out == "flags=execute");
+
+    for (std::uint64_t packed = 0; packed < 256; ++packed) {
+        const permission value = tmdesc::unpack_flags<permission>(packed);
+        CHECK(tmdesc::pack_flags(value) == (packed & 0b10000111));
+        permission decoded = permission::none;
+        CHECK(tmdesc::flags_from_string(tmdesc::flags_to_string(value), decoded));
+        CHECK(decoded == value);
+    }
+}
@@ -0,0 +1,70 @@
+#include "test_helpers.hpp"
+#include <cstdint>
+#include <string>
+#include <tmdesc/enum_string.hpp>
+
+namespace enum_string_test {
+enum class color { red, green, blue, crimson = red };
+template <class Impl> constexpr auto tmdesc_info(tmdesc::info_builder<color, Impl> b) {
+    return b.type(b.attributes(b.type_name("color")),
+                  b.enumerators(b.enumerator("red", color::red),     //
+                                b.enumerator("green", color::green), //
+                                b.enumerator("blue", color::blue),   //
+                                b.enumerator("crimson", color::crimson)));
+}
+
+enum flags : std::int64_t { none = 0, first = 1, big = 1ll << 40, negative = -(1ll << 50) };
+template <class Impl> constexpr auto tmdesc_info(tmdesc::info_builder<flags, Impl> b) {
+    return b.type(b.enumerators(b.enumerator("none", none),         //
+                                b.enumerator("first", first),       //
+                                b.enumerator("big", big),           //
+                                b.enumerator("negative", negative)));
+}
+
+enum class undescribed { a };
+
+STATIC_CHECK(tmdesc::is_described_enum_v<color>);
+STATIC_CHECK(tmdesc::is_described_enum_v<flags>);
+STATIC_CHECK(!tmdesc::is_described_enum_v<undescribed>);
+STATIC_CHECK(!tmdesc::is_described_enum_v<int>);
+
+STATIC_CHECK(tmdesc::detail::enum_index<color>::dense);
+STATIC_CHECK(!tmdesc::detail::enum_index<flags>::dense);
+
+STATIC_CHECK(tmdesc::to_string(color::green) == "green");
+STATIC_CHECK(tmdesc::to_string(color::crimson) == "red");
+STATIC_CHECK(tmdesc::to_string(static_cast<color>(10)).empty());
+STATIC_CHECK(tmdesc::to_string(negative) == "negative");
+STATIC_CHECK(tmdesc::to_string(big) == "big");
+STATIC_CHECK(tmdesc::to_string(static_cast<flags>(2)).empty());
+
+constexpr color parsed(tmdesc::string_view name) {
+    color result = color::blue;
+    tmdesc::from_string(name, result);
+    return result;
+}
+STATIC_CHECK(parsed("green") == color::green);
+STATIC_CHECK(parsed("crimson") == color::red);
+STATIC_CHECK(parsed("purple") == color::blue);
+} // namespace enum_string_test
+
+TEST_CASE("enum to_string and from_string") {
+    using namespace enum_string_test;
+    CHECK(tmdesc::at_key(tmdesc::static_type_attributes_v<color>.value(), tmdesc::type_c<tmdesc::tags::type_name>) ==
+          "color");
+    std::string names;
+    for (const auto& e : tmdesc::static_type_enumerators_v<color>.value()) {
+        names += e.name().c_str();
+        names += tmdesc::to_string(e.value()).c_str();
+    }
+    CHECK(names == "redredgreengreenbluebluecrimsonred");
+
+    flags f = none;
+    CHECK(tmdesc::from_string("big", f));
+    CHECK(f == big);
+    CHECK(!tmdesc::from_string("Big", f));
+    CHECK(f == big);
+    CHECK(tmdesc::from_string("negative", f));
+    CHECK(f == negative);
+    CHECK(tmdesc::to_string(f) == "negative");
+}
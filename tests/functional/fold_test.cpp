@@ -0,0 +1,62 @@
+#include "../test_helpers.hpp"
+#include <string>
+#include <tmdesc/functional/fold_tree.hpp>
+#include <tmdesc/functional/variadic_fold_left.hpp>
+#include <utility>
+
+namespace fold_test {
+/// non-commutative, non-associative: the result shows the order of applications
+struct append_digit {
+    constexpr int operator()(int acc, int digit) const noexcept { return acc * 10 + digit; }
+};
+struct plus {
+    template <class L, class R> constexpr auto operator()(const L& l, const R& r) const noexcept { return l + r; }
+};
+struct concat {
+    std::string operator()(const std::string& l, const std::string& r) const { return "(" + l + r + ")"; }
+};
+struct identity {
+    constexpr int operator()(int v) const noexcept { return v; }
+};
+struct ref_identity {
+    int& operator()(int& v) const noexcept { return v; }
+};
+
+template <std::size_t... Is> constexpr std::size_t sum_tree(std::index_sequence<Is...>) noexcept {
+    return tmdesc::fold_tree(plus{}, Is...);
+}
+} // namespace fold_test
+
+TEST_CASE("variadic_fold_left") {
+    using namespace fold_test;
+    STATIC_CHECK(7 == tmdesc::variadic_fold_left(identity{}, 7));
+    STATIC_CHECK(12 == tmdesc::variadic_fold_left(append_digit{}, 1, 2));
+    STATIC_CHECK(12345 == tmdesc::variadic_fold_left(append_digit{}, 1, 2, 3, 4, 5));
+    STATIC_CHECK(123456 == tmdesc::variadic_fold_left(append_digit{}, 1, 2, 3, 4, 5, 6));
+    STATIC_CHECK(123456789 == tmdesc::variadic_fold_left(append_digit{}, 1, 2, 3, 4, 5, 6, 7, 8, 9));
+    STATIC_NOTHROW_CHECK(tmdesc::variadic_fold_left(append_digit{}, 1, 2, 3, 4, 5, 6, 7));
+}
+
+TEST_CASE("fold_tree") {
+    using namespace fold_test;
+    SUBCASE("tree shape") {
+        STATIC_CHECK(7 == tmdesc::fold_tree(identity{}, 7));
+        CHECK(tmdesc::fold_tree(concat{}, std::string("a"), std::string("b")) == "(ab)");
+        CHECK(tmdesc::fold_tree(concat{}, std::string("a"), std::string("b"), std::string("c")) == "((ab)c)");
+        CHECK(tmdesc::fold_tree(concat{}, std::string("a"), std::string("b"), std::string("c"), std::string("d")) ==
+              "((ab)(cd))");
+    }
+    SUBCASE("forwarding") {
+        int x = 1;
+        tmdesc::fold_tree(ref_identity{}, x) = 2;
+        CHECK(x == 2);
+        STATIC_NOTHROW_CHECK(tmdesc::fold_tree(plus{}, 1, 2, 3));
+    }
+    SUBCASE("heterogeneous") {
+        STATIC_CHECK(10.5 == tmdesc::fold_tree(plus{}, 1, 2.5, 3u, 4l));
+    }
+    SUBCASE("large pack") {
+        // linear fold of 2000 arguments exceeds the constexpr evaluation depth
+        STATIC_CHECK(1999 * 2000 / 2 == sum_tree(std::make_index_sequence<2000>{}));
+    }
+}
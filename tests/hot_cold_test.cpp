@@ -0,0 +1,149 @@
+#include "test_helpers.hpp"
+#include <cstdint>
+#include <string>
+#include <tmdesc/algorithm/for_each.hpp>
+#include <tmdesc/hot_cold.hpp>
+#include <tmdesc/member_name.hpp>
+#include <tmdesc/members_view.hpp>
+
+namespace hot_cold_test {
+struct order {
+    std::uint64_t id;
+    std::string account;
+    double price;
+    std::int64_t quantity;
+    std::string comment;
+
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<order, Impl> b) {
+        return b.type(b.attributes(b.type_name("order")),
+                      b.members(b.member("id", &order::id, b.attributes(b.hot())),    //
+                                b.member("account", &order::account),                 //
+                                b.member("price", &order::price, b.attributes(b.hot())), //
+                                b.member("quantity", &order::quantity, b.attributes(b.hot_write())),
+                                b.member("comment", &order::comment)));
+    }
+};
+
+using hot_order  = tmdesc::hot_part<order>;
+using cold_order = tmdesc::cold_part<order>;
+
+STATIC_CHECK(tmdesc::member_index_v<hot_order, TMDESC_NAME("id")> == 0);
+STATIC_CHECK(tmdesc::member_index_v<hot_order, TMDESC_NAME("quantity")> == 2);
+STATIC_CHECK(tmdesc::member_index_v<hot_order, TMDESC_NAME("account")> == tmdesc::string_view::npos);
+STATIC_CHECK(tmdesc::member_index_v<cold_order, TMDESC_NAME("comment")> == 1);
+STATIC_CHECK(sizeof(hot_order) == 3 * 8);
+STATIC_CHECK(tmdesc::at_key(tmdesc::static_type_attributes_v<cold_order>.value(),
+                            tmdesc::type_c<tmdesc::tags::type_name>) == "order");
+
+/// the copy of the cold member throws if `fail` is set
+struct fragile {
+    bool fail = false;
+
+    fragile() = default;
+    fragile(const fragile& other)
+      : fail(other.fail) {
+        if (fail)
+            throw 1;
+    }
+    fragile& operator=(const fragile& other) {
+        if (other.fail)
+            throw 1;
+        return *this;
+    }
+};
+
+struct fragile_order {
+    int id;
+    fragile note;
+
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<fragile_order, Impl> b) {
+        return b.type(b.members(b.member("id", &fragile_order::id, b.attributes(b.hot())),
+                                b.member("note", &fragile_order::note)));
+    }
+};
+
+struct collect_names {
+    std::string& out;
+    template <class M> void operator()(M member) const {
+        out += member.name().c_str();
+        out += ' ';
+    }
+};
+} // namespace hot_cold_test
+
+TEST_CASE("hot_part and cold_part") {
+    using namespace hot_cold_test;
+    const order o{1, "acc", 2.5, 10, "note"};
+    hot_order hot(o);
+    cold_order cold(o);
+    CHECK(tmdesc::get_member<TMDESC_NAME("price")>(hot) == 2.5);
+    CHECK(tmdesc::get_member<TMDESC_NAME("account")>(cold) == "acc");
+
+    std::string names;
+    tmdesc::for_each(tmdesc::members_view(hot), collect_names{names});
+    CHECK(names == "id price quantity ");
+
+    order restored{};
+    hot.copy_to(restored);
+    CHECK(restored.quantity == 10);
+    CHECK(restored.account.empty());
+    cold.copy_to(restored);
+    CHECK(restored.comment == "note");
+}
+
+TEST_CASE("split_vector") {
+    using namespace hot_cold_test;
+    tmdesc::split_vector<order> orders;
+    orders.push_back(order{1, "a", 1.5, 10, "first"});
+    orders.push_back(order{2, "b", 2.5, 20, "second"});
+    CHECK(orders.size() == 2);
+    CHECK(orders.hot_parts().size() == 2);
+
+    std::int64_t total = 0;
+    for (const auto& hot : orders.hot_parts())
+        total += tmdesc::get_member<TMDESC_NAME("quantity")>(hot);
+    CHECK(total == 30);
+
+    auto second = orders[1];
+    static_assert(std::is_same<decltype(tmdesc::get_member<TMDESC_NAME("comment")>(second)), std::string&>::value, "");
+    tmdesc::get_member<TMDESC_NAME("comment")>(second) = "changed";
+    tmdesc::get_member<TMDESC_NAME("price")>(orders[1]) = 3.5;
+
+    const tmdesc::split_vector<order>& const_orders = orders;
+    static_assert(std::is_same<decltype(tmdesc::get_member<TMDESC_NAME("id")>(const_orders[0])),
+                               const std::uint64_t&>::value,
+                  "");
+    const order o = const_orders[1].get();
+    CHECK(o.id == 2);
+    CHECK(o.comment == "changed");
+    CHECK(o.price == 3.5);
+
+    std::string names;
+    auto first = orders[0];
+    tmdesc::for_each(tmdesc::members_view(first), collect_names{names});
+    CHECK(names == "id account price quantity comment ");
+
+    orders[0].set(order{7, "z", 0.5, 1, "replaced"});
+    CHECK(orders[0].get().account == "z");
+    orders.pop_back();
+    CHECK(orders.size() == 1);
+}
+
+TEST_CASE("split_vector push_back keeps the parts paired if the copy throws") {
+    using namespace hot_cold_test;
+    tmdesc::split_vector<fragile_order> orders;
+    orders.push_back(fragile_order{1, fragile{}});
+
+    fragile_order failing{2, fragile{}};
+    failing.note.fail = true;
+    bool thrown       = false;
+    try {
+        orders.push_back(failing);
+    } catch (int) {
+        thrown = true;
+    }
+    CHECK(thrown);
+    CHECK(orders.size() == 1);
+    CHECK(orders.hot_parts().size() == 1);
+    CHECK(orders[0].get().id == 1);
+}
@@ -0,0 +1,72 @@
+#include "test_helpers.hpp"
+#include <string>
+#include <tmdesc/inline_string.hpp>
+
+STATIC_CHECK(tmdesc::inline_string<15>::inline_capacity == 15);
+STATIC_CHECK(std::is_convertible<tmdesc::inline_string<8>, tmdesc::string_view>::value);
+
+TEST_CASE("inline_string stores short strings inline") {
+    tmdesc::inline_string<8> s;
+    CHECK(s.empty());
+    CHECK(s.capacity() == 8);
+    CHECK(*s.c_str() == '\0');
+
+    s = "ticker";
+    CHECK(s.is_inline());
+    CHECK(s == "ticker");
+    CHECK(s.size() == 6);
+    s += "12";
+    CHECK(s.is_inline());
+    CHECK(s == tmdesc::string_view("ticker12"));
+    CHECK(s.c_str()[8] == '\0');
+
+    s += '!';
+    CHECK(!s.is_inline());
+    CHECK(s == std::string("ticker12!"));
+    CHECK(s.c_str()[9] == '\0');
+
+    s.resize(3);
+    CHECK(s == "tic");
+    s.resize(5, 'k');
+    CHECK(s == "tickk");
+    s.pop_back();
+    CHECK(s.str() == "tick");
+    s.clear();
+    CHECK(s.empty());
+    CHECK(*s.c_str() == '\0');
+}
+
+TEST_CASE("inline_string move leaves the empty source") {
+    tmdesc::inline_string<4> inline_source("abc");
+    tmdesc::inline_string<4> moved(std::move(inline_source));
+    CHECK(moved == "abc");
+    CHECK(inline_source.empty());
+    CHECK(*inline_source.c_str() == '\0');
+    inline_source += "xy";
+    CHECK(inline_source == "xy");
+
+    tmdesc::inline_string<4> heap_source("longer than four");
+    moved = std::move(heap_source);
+    CHECK(moved == "longer than four");
+    CHECK(heap_source.empty());
+    CHECK(*heap_source.c_str() == '\0');
+    heap_source.append("reused");
+    CHECK(heap_source == "reused");
+    CHECK(heap_source.size() == 6);
+}
+
+TEST_CASE("inline_string assign and append of its own characters") {
+    tmdesc::inline_string<4> s("abc");
+    s.append(s);
+    CHECK(s == "abcabc");
+    s.append(s.data() + 1, 2);
+    CHECK(s == "abcabcbc");
+    s.assign(s.data() + 3, 3);
+    CHECK(s == "abc");
+    s.assign(tmdesc::string_view(""));
+    CHECK(s.empty());
+
+    const tmdesc::inline_string<4> copy = std::string("xy");
+    CHECK(copy < tmdesc::string_view("xz"));
+    CHECK(tmdesc::string_view(copy).size() == 2);
+}
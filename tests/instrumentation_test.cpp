@@ -0,0 +1,66 @@
+#include "test_helpers.hpp"
+#include <string>
+#include <thread>
+#include <tmdesc/instrumentation.hpp>
+#include <tmdesc/visit_member.hpp>
+
+namespace instrumentation_test {
+struct order {
+    int id;
+    double price;
+
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<order, Impl> b) {
+        return b.type(b.attributes(b.type_name("order")),
+                      b.members(b.member("id", &order::id), b.member("price", &order::price)));
+    }
+};
+
+struct quote {
+    int id;
+};
+
+struct ignore {
+    template <class T> void operator()(const T&) const noexcept {}
+};
+
+using disabled_scope = tmdesc::no_instrumentation::scope<order>;
+static_assert(std::is_empty<disabled_scope>::value, "");
+static_assert(std::is_trivially_destructible<disabled_scope>::value, "");
+
+tmdesc::instrumentation_counters counters_of(tmdesc::type_id type) {
+    for (const auto& c : tmdesc::instrumentation_snapshot()) {
+        if (c.type == type)
+            return c;
+    }
+    return {type, {}, 0, 0, 0};
+}
+} // namespace instrumentation_test
+
+TEST_CASE("counting_instrumentation") {
+    using namespace instrumentation_test;
+    const auto before = counters_of(tmdesc::type_id_v<order>);
+
+    order o{1, 2.5};
+    CHECK(tmdesc::instrumented_visit_member_by_name<tmdesc::counting_instrumentation>(o, "price", ignore{}));
+    CHECK(!tmdesc::instrumented_visit_member_by_name<tmdesc::counting_instrumentation>(o, "none", ignore{}));
+    CHECK(tmdesc::visit_member_by_name(o, "id", ignore{}));
+    {
+        tmdesc::counting_instrumentation::scope<order> scope;
+        scope.add_bytes(10);
+    }
+    std::thread([] {
+        tmdesc::counting_instrumentation::scope<order> scope;
+        scope.add_bytes(5);
+    }).join();
+    {
+        tmdesc::counting_instrumentation::scope<quote> scope;
+    }
+
+    const auto after = counters_of(tmdesc::type_id_v<order>);
+    CHECK(after.type_name == "order");
+    CHECK(after.calls - before.calls == 4);
+    CHECK(after.bytes - before.bytes == 15);
+    CHECK(after.cycles >= before.cycles);
+    CHECK(counters_of(tmdesc::type_id_v<quote>).calls >= 1);
+    CHECK(counters_of(tmdesc::type_id_v<quote>).type_name.empty());
+}
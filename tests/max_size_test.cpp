@@ -0,0 +1,135 @@
+#include "test_helpers.hpp"
+#include <cstdint>
+#include <random>
+#include <string>
+#include <tmdesc/max_size.hpp>
+#include <tmdesc/object_graph.hpp>
+#include <tmdesc/random_fill.hpp>
+#include <vector>
+
+namespace max_size_test {
+struct fill {
+    double price;
+    std::uint32_t quantity;
+
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<fill, Impl> b) {
+        return b.type(b.members(b.member("price", &fill::price), b.member("quantity", &fill::quantity)));
+    }
+};
+
+struct order {
+    tmdesc::inline_string<15> symbol;
+    tmdesc::small_vector<fill, 4> fills;
+    std::string note;
+    std::vector<std::uint8_t> flags;
+
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<order, Impl> b) {
+        return b.type(b.members(b.member("symbol", &order::symbol, b.attributes(b.max_size(15))),
+                                b.member("fills", &order::fills, b.attributes(b.max_size(6))),
+                                b.member("note", &order::note),
+                                b.member("flags", &order::flags, b.attributes(b.max_size(2)))));
+    }
+};
+
+struct text_view {
+    const char* chars;
+    std::size_t length;
+    text_view(const char* chars_, std::size_t length_) noexcept
+      : chars(chars_)
+      , length(length_) {}
+    const char* data() const noexcept { return chars; }
+    std::size_t size() const noexcept { return length; }
+};
+
+struct quote {
+    tmdesc::string_view venue;
+    text_view text;
+
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<quote, Impl> b) {
+        return b.type(b.members(b.member("venue", &quote::venue, b.attributes(b.max_size(4))),
+                                b.member("text", &quote::text, b.attributes(b.borrowed(), b.max_size(8)))));
+    }
+};
+
+struct batch {
+    std::vector<order> orders;
+
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<batch, Impl> b) {
+        return b.type(b.members(b.member("orders", &batch::orders)));
+    }
+};
+
+STATIC_CHECK(tmdesc::max_size_v<order, 0> == 15);
+STATIC_CHECK(tmdesc::max_size_v<order, 1> == 6);
+STATIC_CHECK(tmdesc::max_size_v<order, 2> == tmdesc::unlimited_size);
+
+order make_order() {
+    order o{"EURUSD", {{1.25, 10}, {1.5, 20}}, std::string(100, 'n'), {1, 2}};
+    return o;
+}
+} // namespace max_size_test
+
+TEST_CASE("check_max_sizes") {
+    using namespace max_size_test;
+    batch b{{make_order(), make_order()}};
+    CHECK(tmdesc::check_max_sizes(b));
+
+    b.orders[1].flags.push_back(3);
+    CHECK(!tmdesc::check_max_sizes(b));
+    b.orders[1].flags.pop_back();
+
+    b.orders[0].symbol = "SIXTEEN_CHARS_XX";
+    CHECK(!tmdesc::check_max_sizes(b));
+
+    CHECK(tmdesc::check_max_sizes(quote{"XNYS", {"12.5", 4}}));
+    CHECK(!tmdesc::check_max_sizes(quote{"XNYSE", {"12.5", 4}}));
+    CHECK(!tmdesc::check_max_sizes(quote{"XNYS", {"123456789", 9}}));
+}
+
+TEST_CASE("decode_graph keeps inline_string and small_vector within max_size inline") {
+    using namespace max_size_test;
+    const order o = make_order();
+    std::string out;
+    tmdesc::encode_graph(o, out);
+
+    order decoded{};
+    CHECK(tmdesc::decode_graph(out, decoded));
+    CHECK(decoded.symbol == "EURUSD");
+    CHECK(decoded.symbol.is_inline());
+    REQUIRE(decoded.fills.size() == 2);
+    CHECK(decoded.fills.is_inline());
+    CHECK(decoded.fills[1].quantity == 20);
+    CHECK(decoded.note.size() == 100);
+    CHECK(decoded.flags == o.flags);
+
+    order too_long = make_order();
+    for (int i = 0; i < 5; ++i)
+        too_long.fills.push_back(fill{2.0, 1});
+    out.clear();
+    tmdesc::encode_graph(too_long, out);
+    CHECK(!tmdesc::decode_graph(out, decoded));
+
+    too_long = make_order();
+    too_long.symbol.append("_AND_MORE_CHARS");
+    out.clear();
+    tmdesc::encode_graph(too_long, out);
+    CHECK(!tmdesc::decode_graph(out, decoded));
+}
+
+TEST_CASE("random_fill respects max_size") {
+    using namespace max_size_test;
+    std::mt19937_64 rng(3);
+    tmdesc::random_fill_options options;
+    options.string_size    = {10, 40};
+    options.container_size = {5, 10};
+
+    for (int i = 0; i < 20; ++i) {
+        order o{};
+        tmdesc::random_fill(o, rng, options);
+        CHECK(tmdesc::check_max_sizes(o));
+        CHECK(o.symbol.size() >= 10);
+        CHECK(o.fills.size() >= 5);
+        CHECK(o.note.size() >= 10);
+        CHECK(o.flags.size() == 2);
+    }
+}
@@ -0,0 +1,61 @@
+#include "test_helpers.hpp"
+#include <string>
+#include <tmdesc/member_name.hpp>
+
+namespace member_name_test {
+struct config {
+    int threads;
+    double ratio;
+    std::string title;
+
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<config, Impl> b) {
+        return b.type(b.members(b.member("threads", &config::threads), //
+                                b.member("ratio", &config::ratio),     //
+                                b.member("title", &config::title)));
+    }
+};
+
+struct point {
+    int x;
+    int y;
+
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<point, Impl> b) {
+        return b.type(b.members(b.member("x", &point::x), b.member("y", &point::y)));
+    }
+};
+
+using threads_name = TMDESC_NAME("threads");
+
+STATIC_CHECK(std::is_same<TMDESC_NAME("ratio"), tmdesc::member_name<'r', 'a', 't', 'i', 'o'>>::value);
+STATIC_CHECK(std::is_same<TMDESC_NAME(""), tmdesc::member_name<>>::value);
+STATIC_CHECK(threads_name::value() == "threads");
+using longest_name = TMDESC_NAME("abcdefghijklmnopqrstuvwxyz0123456789abcdefghijklmnopqrstuvwxyz01");
+STATIC_CHECK(longest_name::value().size() == 64);
+
+STATIC_CHECK(tmdesc::member_index_v<config, threads_name> == 0);
+STATIC_CHECK(tmdesc::member_index_v<config, TMDESC_NAME("title")> == 2);
+STATIC_CHECK(tmdesc::member_index_v<config, TMDESC_NAME("titles")> == tmdesc::string_view::npos);
+
+constexpr point moved_right(point p, int dx) {
+    tmdesc::get_member<TMDESC_NAME("x")>(p) += dx;
+    return p;
+}
+STATIC_CHECK(moved_right({1, 2}, 3).x == 4);
+STATIC_CHECK(moved_right({1, 2}, 3).y == 2);
+} // namespace member_name_test
+
+TEST_CASE("get_member") {
+    using namespace member_name_test;
+    config cfg{1, 0.5, "title"};
+    static_assert(std::is_same<decltype(tmdesc::get_member<threads_name>(cfg)), int&>::value, "");
+    static_assert(std::is_same<decltype(tmdesc::get_member<threads_name>(std::move(cfg))), int&&>::value, "");
+
+    tmdesc::get_member<threads_name>(cfg) = 8;
+    CHECK(cfg.threads == 8);
+    CHECK(&tmdesc::get_member<TMDESC_NAME("ratio")>(cfg) == &cfg.ratio);
+
+    const config& ccfg = cfg;
+    static_assert(std::is_same<decltype(tmdesc::get_member<TMDESC_NAME("title")>(ccfg)), const std::string&>::value,
+                  "");
+    CHECK(tmdesc::get_member<TMDESC_NAME("title")>(ccfg) == "title");
+}
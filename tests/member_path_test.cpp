@@ -0,0 +1,82 @@
+#include "test_helpers.hpp"
+#include <string>
+#include <tmdesc/member_path.hpp>
+
+namespace member_path_test {
+struct endpoint {
+    std::string host;
+    int port;
+
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<endpoint, Impl> b) {
+        return b.type(b.members(b.member("host", &endpoint::host), b.member("port", &endpoint::port)));
+    }
+};
+
+struct server {
+    int threads;
+    endpoint listen;
+
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<server, Impl> b) {
+        return b.type(b.members(b.member("threads", &server::threads), b.member("listen", &server::listen)));
+    }
+};
+
+struct config {
+    bool verbose;
+    server srv;
+
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<config, Impl> b) {
+        return b.type(b.members(b.member("verbose", &config::verbose), b.member("server", &config::srv)));
+    }
+};
+} // namespace member_path_test
+
+TEST_CASE("member_path") {
+    using namespace member_path_test;
+    config cfg{false, {4, {"localhost", 80}}};
+
+    SUBCASE("nested access") {
+        const auto port = tmdesc::path<config>("server.listen.port");
+        REQUIRE(port.valid());
+        CHECK(port.leaf()->name == "port");
+        CHECK(port.address(cfg) == &cfg.srv.listen.port);
+        REQUIRE(port.get_if<int>(cfg) != nullptr);
+        *port.get_if<int>(cfg) = 8080;
+        CHECK(cfg.srv.listen.port == 8080);
+
+        const config& ccfg = cfg;
+        const auto host    = tmdesc::path<config>("server.listen.host");
+        REQUIRE(host.get_if<std::string>(ccfg) != nullptr);
+        CHECK(*host.get_if<std::string>(ccfg) == "localhost");
+    }
+    SUBCASE("single segment") {
+        const auto verbose = tmdesc::path<config>("verbose");
+        REQUIRE(verbose.get_if<bool>(cfg) != nullptr);
+        CHECK(verbose.offset() == 0);
+        CHECK(tmdesc::path<config>("server").get_if<server>(cfg) == &cfg.srv);
+    }
+    SUBCASE("type mismatch") {
+        const auto port = tmdesc::path<config>("server.listen.port");
+        CHECK(port.get_if<long>(cfg) == nullptr);
+        CHECK(port.get_if<unsigned>(cfg) == nullptr);
+    }
+    SUBCASE("unresolved") {
+        CHECK_FALSE(tmdesc::path<config>("server.listen.address"));
+        CHECK_FALSE(tmdesc::path<config>("server.threads.count"));
+        CHECK_FALSE(tmdesc::path<config>("server..port"));
+        CHECK_FALSE(tmdesc::path<config>("server.listen."));
+        CHECK_FALSE(tmdesc::path<config>(""));
+        CHECK(tmdesc::path<config>("srv").address(cfg) == nullptr);
+        CHECK(tmdesc::path<config>("srv").get_if<server>(cfg) == nullptr);
+    }
+}
+
+TEST_CASE("member_table::find") {
+    using namespace member_path_test;
+    const tmdesc::member_table& table = tmdesc::member_table_of<server>();
+    REQUIRE(table.find("listen") != nullptr);
+    CHECK(table.find("listen") == &table[1]);
+    CHECK(table.find("listen")->nested == &tmdesc::member_table_of<endpoint>());
+    CHECK(table.find("listen")->is<endpoint>());
+    CHECK(table.find("port") == nullptr);
+}
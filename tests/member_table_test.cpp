@@ -0,0 +1,132 @@
+#include "test_helpers.hpp"
+#include <cstdint>
+#include <string>
+#include <tmdesc/member_table.hpp>
+
+namespace member_table_test {
+enum class color { red, green };
+template <class Impl> constexpr auto tmdesc_info(tmdesc::info_builder<color, Impl> b) {
+    return b.type(b.enumerators(b.enumerator("red", color::red), b.enumerator("green", color::green)));
+}
+// user overloads found by ADL must not replace the described conversions
+inline std::string to_string(color) { return "user"; }
+inline bool from_string(tmdesc::string_view, color&) { return false; }
+
+struct point {
+    int x;
+    double y;
+
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<point, Impl> b) {
+        return b.type(b.members(b.member("x", &point::x), b.member("y", &point::y)));
+    }
+};
+
+struct base {
+    std::uint16_t id;
+};
+
+struct shape : base {
+    std::string name;
+    point origin;
+    bool visible;
+    color fill;
+    tmdesc::string_view tag;
+    void* user_data;
+
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<shape, Impl> b) {
+        return b.type(b.members(b.member("id", &shape::id),            //
+                                b.member("name", &shape::name),        //
+                                b.member("origin", &shape::origin),    //
+                                b.member("visible", &shape::visible),  //
+                                b.member("fill", &shape::fill),        //
+                                b.member("tag", &shape::tag),          //
+                                b.member("user_data", &shape::user_data)));
+    }
+};
+
+/// the table does not construct the object
+struct connection {
+    int fd;
+    std::string peer;
+
+    explicit connection(int fd_)
+      : fd(fd_) {
+        if (fd < 0)
+            throw fd;
+    }
+
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<connection, Impl> b) {
+        return b.type(b.members(b.member("fd", &connection::fd), b.member("peer", &connection::peer)));
+    }
+};
+} // namespace member_table_test
+
+TEST_CASE("member_table") {
+    using namespace member_table_test;
+    const tmdesc::member_table& table = tmdesc::member_table_of<shape>();
+
+    REQUIRE(table.size() == 7);
+    CHECK(table.type_size == sizeof(shape));
+    CHECK(&table == &tmdesc::member_table_of<shape>());
+
+    SUBCASE("names and kinds") {
+        CHECK(table[0].name == "id");
+        CHECK(table[0].kind == tmdesc::member_kind::unsigned_integer);
+        CHECK(table[0].size == sizeof(std::uint16_t));
+        CHECK(table[1].kind == tmdesc::member_kind::string);
+        CHECK(table[2].kind == tmdesc::member_kind::described);
+        CHECK(table[3].kind == tmdesc::member_kind::boolean);
+        CHECK(table[4].kind == tmdesc::member_kind::enumeration);
+        CHECK(table[5].kind == tmdesc::member_kind::string_view);
+        CHECK(table[6].kind == tmdesc::member_kind::other);
+    }
+    SUBCASE("nested table") {
+        CHECK(table[2].nested == &tmdesc::member_table_of<point>());
+        CHECK(table[2].nested->size() == 2);
+        CHECK(table[2].nested->operator[](1).kind == tmdesc::member_kind::floating_point);
+        CHECK(table[0].nested == nullptr);
+    }
+    SUBCASE("enumeration table") {
+        REQUIRE(table[4].enumeration != nullptr);
+        CHECK(table[4].enumeration->size == 2);
+        CHECK(table[0].enumeration == nullptr);
+
+        shape s{};
+        s.fill = color::green;
+        CHECK(table[4].enumeration->to_string(table[4].address(&s)) == "green");
+        CHECK(table[4].enumeration->from_string("red", table[4].address(&s)));
+        CHECK(s.fill == color::red);
+        CHECK(!table[4].enumeration->from_string("blue", table[4].address(&s)));
+    }
+    SUBCASE("member addresses") {
+        shape s{};
+        s.id = 42;
+        s.origin.y = 2.5;
+        CHECK(table[0].address(&s) == &s.id);
+        CHECK(table[1].address(&s) == &s.name);
+        CHECK(table[6].address(&s) == &s.user_data);
+
+        const point& origin = *static_cast<const point*>(table[2].address(&s));
+        const auto& y_desc  = (*table[2].nested)[1];
+        CHECK(*static_cast<const double*>(y_desc.address(&origin)) == 2.5);
+        CHECK(static_cast<const char*>(y_desc.address(table[2].address(&s))) ==
+              reinterpret_cast<const char*>(&s.origin.y));
+    }
+    SUBCASE("iteration") {
+        std::size_t names_size = 0;
+        for (const auto& member : table) {
+            names_size += member.name.size();
+        }
+        CHECK(names_size == std::string("idnameoriginvisiblefilltaguser_data").size());
+    }
+}
+
+TEST_CASE("member_table of the type without default constructor") {
+    using namespace member_table_test;
+    const tmdesc::member_table& table = tmdesc::member_table_of<connection>();
+    REQUIRE(table.size() == 2);
+    connection c(3);
+    c.peer = "host";
+    CHECK(*static_cast<const int*>(table[0].address(&c)) == 3);
+    CHECK(*static_cast<const std::string*>(table[1].address(&c)) == "host");
+}
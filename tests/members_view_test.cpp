@@ -0,0 +1,94 @@
+#include "test_helpers.hpp"
+#include <string>
+#include <tmdesc/algorithm/for_each.hpp>
+#include <tmdesc/members_view.hpp>
+
+namespace members_view_test {
+struct note_tag {};
+
+struct point {
+    int x;
+    int y;
+
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<point, Impl> b) {
+        return b.type(b.members(b.member("x", &point::x),
+                                b.member("y", &point::y, b.attributes(tmdesc::attribute<note_tag, int>{10}))));
+    }
+};
+
+struct scale {
+    int factor;
+    template <class M> constexpr void operator()(M member) const noexcept { member.get() *= factor; }
+};
+
+constexpr point scaled(point p, int factor) {
+    tmdesc::for_each(tmdesc::members_view(p), scale{factor});
+    return p;
+}
+STATIC_CHECK(scaled({1, 2}, 3).x == 3);
+STATIC_CHECK(scaled({1, 2}, 3).y == 6);
+
+struct named_y {
+    template <class MI> constexpr bool operator()(const MI& mi) const noexcept { return mi.name() == "y"; }
+};
+struct named_z {
+    template <class MI> constexpr bool operator()(const MI& mi) const noexcept { return mi.name() == "z"; }
+};
+
+constexpr point with_noted(point p, int value) {
+    tmdesc::find_with_attribute(tmdesc::members_view(p), tmdesc::type_c<note_tag>).value().get() = value;
+    return p;
+}
+STATIC_CHECK(with_noted({1, 2}, 5).y == 5);
+STATIC_CHECK(with_noted({1, 2}, 5).x == 1);
+
+} // namespace members_view_test
+
+TEST_CASE("members_view") {
+    using namespace members_view_test;
+    const point p{1, 2};
+    std::string names;
+    int values = 0;
+    int notes  = 0;
+    tmdesc::for_each(tmdesc::members_view(p), [&](auto member) {
+        static_assert(std::is_same<decltype(member.get()), const int&>::value, "const object has const members");
+        names += member.name().c_str();
+        values += member.get();
+        notes += decltype(tmdesc::contains(member.attributes(), tmdesc::type_c<note_tag>))::value ? 1 : 0;
+    });
+    CHECK(names == "xy");
+    CHECK(values == 3);
+    CHECK(notes == 1);
+}
+
+TEST_CASE("members_view search") {
+    using namespace members_view_test;
+    point p{1, 2};
+    auto y = tmdesc::find_if(tmdesc::members_view(p), named_y{});
+    static_assert(std::is_same<decltype(y.value().get()), int&>::value, "");
+    CHECK(y.value().name() == "y");
+    y.value().get() = 20;
+    CHECK(p.y == 20);
+
+    const point& cp = p;
+    auto noted      = tmdesc::find_with_attribute(tmdesc::members_view(cp), tmdesc::type_c<note_tag>);
+    static_assert(std::is_same<decltype(noted.value().get()), const int&>::value, "");
+    CHECK(noted.value().get() == 20);
+    CHECK(tmdesc::at_key(noted.value().attributes(), tmdesc::type_c<note_tag>) == 10);
+
+    static_assert(std::is_same<decltype(tmdesc::find_if(tmdesc::members_view(p), named_z{})), tmdesc::none_t>::value,
+                  "");
+
+    // the capturing lambda with the constant result
+    int calls     = 0;
+    auto has_note = [&calls](const auto& mi) {
+        ++calls;
+        return tmdesc::has_key<decltype(mi.attributes()), note_tag>{};
+    };
+    auto noted_ref = tmdesc::find_if(tmdesc::members_view(p), has_note);
+    CHECK(noted_ref.value().name() == "y");
+    CHECK(calls == 0);
+    static_assert(std::is_same<decltype(tmdesc::find_with_attribute(tmdesc::members_view(p), tmdesc::type_c<int>)),
+                               tmdesc::none_t>::value,
+                  "");
+}
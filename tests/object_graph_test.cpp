@@ -0,0 +1,306 @@
+#include "test_helpers.hpp"
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <tmdesc/object_graph.hpp>
+#include <tmdesc/size_history.hpp>
+#include <vector>
+
+namespace object_graph_test {
+enum class level : std::uint8_t { debug, info, error };
+
+struct setting {
+    std::string key;
+    std::int64_t value;
+    double weight;
+
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<setting, Impl> b) {
+        return b.type(b.members(b.member("key", &setting::key), b.member("value", &setting::value),
+                                b.member("weight", &setting::weight)));
+    }
+};
+
+struct subtree {
+    std::string name;
+    std::vector<setting> settings;
+
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<subtree, Impl> b) {
+        return b.type(b.members(b.member("name", &subtree::name), b.member("settings", &subtree::settings)));
+    }
+};
+
+struct node {
+    std::string name;
+    level log_level;
+    std::shared_ptr<const subtree> defaults;
+    std::vector<std::shared_ptr<subtree>> overrides;
+    const subtree* fallback;
+
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<node, Impl> b) {
+        return b.type(b.members(b.member("name", &node::name), b.member("log_level", &node::log_level),
+                                b.member("defaults", &node::defaults), b.member("overrides", &node::overrides),
+                                b.member("fallback", &node::fallback)));
+    }
+};
+
+struct config {
+    std::array<std::uint16_t, 2> version;
+    tmdesc::string_view label;
+    std::vector<node> nodes;
+
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<config, Impl> b) {
+        return b.type(b.members(b.member("version", &config::version), b.member("label", &config::label),
+                                b.member("nodes", &config::nodes)));
+    }
+};
+
+struct ring {
+    int value;
+    ring* next;
+
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<ring, Impl> b) {
+        return b.type(b.members(b.member("value", &ring::value), b.member("next", &ring::next)));
+    }
+};
+
+struct counter {
+    std::int32_t count;
+
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<counter, Impl> b) {
+        return b.type(b.members(b.member("count", &counter::count)));
+    }
+};
+
+struct aliases {
+    counter* whole;
+    std::int32_t* first;
+
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<aliases, Impl> b) {
+        return b.type(b.members(b.member("whole", &aliases::whole), b.member("first", &aliases::first)));
+    }
+};
+
+struct chain {
+    int value;
+    std::shared_ptr<chain> next;
+
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<chain, Impl> b) {
+        return b.type(b.members(b.member("value", &chain::value), b.member("next", &chain::next)));
+    }
+};
+
+// the overload of decode_graph without the storage is rejected for the values with raw pointers
+STATIC_CHECK(tmdesc::detail::graph_has_raw_pointer<config>::value);
+STATIC_CHECK(tmdesc::detail::graph_has_raw_pointer<std::vector<ring>>::value);
+STATIC_CHECK(!tmdesc::detail::graph_has_raw_pointer<chain>::value);
+STATIC_CHECK(!tmdesc::detail::graph_has_raw_pointer<std::shared_ptr<const subtree>>::value);
+
+/// the chain is destroyed by a loop, the recursive destruction of the long chain overflows the stack
+struct chain_owner {
+    chain root{0, nullptr};
+
+    explicit chain_owner(std::size_t length) {
+        chain* last = &root;
+        for (std::size_t i = 1; i < length; ++i) {
+            last->next = std::make_shared<chain>(chain{int(i), nullptr});
+            last       = last->next.get();
+        }
+    }
+    ~chain_owner() {
+        for (auto next = std::move(root.next); next;)
+            next = std::move(next->next);
+    }
+};
+
+std::shared_ptr<subtree> make_subtree(const std::string& name, int settings) {
+    auto result  = std::make_shared<subtree>();
+    result->name = name;
+    for (int i = 0; i < settings; ++i)
+        result->settings.push_back(setting{"key" + std::to_string(i), i * 1000, i * 0.25});
+    return result;
+}
+
+config make_config(std::size_t nodes, const std::shared_ptr<subtree>& defaults,
+                   const std::shared_ptr<subtree>& shared_override) {
+    config c{{1, 2}, "snapshot", {}};
+    for (std::size_t i = 0; i < nodes; ++i) {
+        c.nodes.push_back(node{"node" + std::to_string(i), level::info, defaults,
+                               {shared_override, make_subtree("local", 1)}, defaults.get()});
+    }
+    return c;
+}
+} // namespace object_graph_test
+
+TEST_CASE("encode_graph writes shared subobjects once") {
+    using namespace object_graph_test;
+    const auto defaults = make_subtree("defaults", 100);
+    const auto common   = make_subtree("common", 10);
+    const config c      = make_config(10, defaults, common);
+
+    std::string out;
+    tmdesc::encode_graph(c, out);
+
+    std::string single;
+    tmdesc::encode_graph(*defaults, single);
+    CHECK(out.size() < 2 * single.size());
+
+    config decoded{};
+    tmdesc::object_graph_storage storage;
+    CHECK(tmdesc::decode_graph(out, decoded, storage));
+    CHECK(storage.size() == 2 + 10);
+
+    REQUIRE(decoded.nodes.size() == 10);
+    CHECK(decoded.version[1] == 2);
+    CHECK(decoded.label == "snapshot");
+    CHECK(decoded.label.data() >= out.data());
+    CHECK(decoded.nodes[0].defaults->settings.size() == 100);
+    CHECK(decoded.nodes[0].defaults->settings[99].value == 99000);
+    CHECK(decoded.nodes[0].defaults->settings[99].weight == 24.75);
+    CHECK(decoded.nodes[9].name == "node9");
+    CHECK(decoded.nodes[9].log_level == level::info);
+    for (const node& n : decoded.nodes) {
+        CHECK(n.defaults == decoded.nodes[0].defaults);
+        CHECK(n.fallback == n.defaults.get());
+        CHECK(n.overrides[0] == decoded.nodes[0].overrides[0]);
+        CHECK(n.overrides[1]->name == "local");
+    }
+    CHECK(decoded.nodes[0].overrides[1] != decoded.nodes[1].overrides[1]);
+
+    std::string again;
+    tmdesc::encode_graph(decoded, again);
+    CHECK(again == out);
+}
+
+TEST_CASE("decode_graph restores cycles and null pointers") {
+    using namespace object_graph_test;
+    ring a{1, nullptr}, b{2, nullptr}, c{3, nullptr};
+    a.next = &b;
+    b.next = &c;
+    c.next = &a;
+    ring root{0, &a};
+
+    std::string out;
+    tmdesc::encode_graph(root, out);
+
+    tmdesc::object_graph_storage storage;
+    ring decoded{};
+    CHECK(tmdesc::decode_graph(out, decoded, storage));
+    CHECK(storage.size() == 3);
+    REQUIRE(decoded.next != nullptr);
+    CHECK(decoded.next->value == 1);
+    CHECK(decoded.next->next->value == 2);
+    CHECK(decoded.next->next->next->value == 3);
+    CHECK(decoded.next->next->next->next == decoded.next);
+
+    ring last{7, nullptr};
+    out.clear();
+    tmdesc::encode_graph(last, out);
+    ring decoded_last{1, &decoded};
+    CHECK(tmdesc::decode_graph(out, decoded_last, storage));
+    CHECK(decoded_last.value == 7);
+    CHECK(decoded_last.next == nullptr);
+    CHECK(storage.size() == 3);
+}
+
+TEST_CASE("encode_graph identifies objects by address and type") {
+    using namespace object_graph_test;
+    counter value{5};
+    const aliases a{&value, &value.count};
+
+    std::string out;
+    tmdesc::encode_graph(a, out);
+
+    tmdesc::object_graph_storage storage;
+    aliases decoded{};
+    CHECK(tmdesc::decode_graph(out, decoded, storage));
+    CHECK(storage.size() == 2);
+    CHECK(decoded.whole->count == 5);
+    CHECK(*decoded.first == 5);
+}
+
+TEST_CASE("decode_graph rejects malformed input") {
+    using namespace object_graph_test;
+    const config c = make_config(2, make_subtree("defaults", 3), make_subtree("common", 1));
+    std::string out;
+    tmdesc::encode_graph(c, out);
+
+    for (std::size_t size = 0; size < out.size(); ++size) {
+        config decoded{};
+        tmdesc::object_graph_storage storage;
+        CHECK(!tmdesc::decode_graph(tmdesc::string_view(out.data(), size), decoded, storage));
+    }
+
+    // the back reference to the object which is not decoded yet
+    ring root{0, nullptr};
+    const std::string forward = std::string(4, '\0') + char(2);
+    tmdesc::object_graph_storage ring_storage;
+    CHECK(!tmdesc::decode_graph(forward, root, ring_storage));
+
+    // the reference to the object of another type
+    counter value{5};
+    aliases a{&value, nullptr};
+    out.clear();
+    tmdesc::encode_graph(a, out);
+    out.back() = char(1);
+    aliases decoded{};
+    tmdesc::object_graph_storage storage;
+    CHECK(!tmdesc::decode_graph(out, decoded, storage));
+}
+
+TEST_CASE("graph nesting depth is limited") {
+    using namespace object_graph_test;
+    const chain_owner short_chain(100);
+    std::string out = "prefix";
+    CHECK(tmdesc::encode_graph(short_chain.root, out));
+    chain_owner decoded(1);
+    tmdesc::object_graph_storage storage;
+    CHECK(tmdesc::decode_graph(tmdesc::string_view(out).substr(6), decoded.root, storage));
+    CHECK(storage.size() == 99);
+    CHECK(decoded.root.next->next->value == 2);
+
+    const chain_owner long_chain(200000);
+    out = "prefix";
+    CHECK(!tmdesc::encode_graph(long_chain.root, out));
+    CHECK(out == "prefix");
+
+    // the input of the same chain: the value and the identifier of the next new object
+    std::string deep;
+    for (std::uint32_t i = 0; i < 200000; ++i) {
+        for (unsigned shift = 0; shift < 32; shift += 8)
+            deep += char(i >> shift);
+        for (std::uint32_t ref = i + 1; ref != 0; ref >>= 7)
+            deep += char((ref & 0x7f) | (ref >= 0x80 ? 0x80 : 0));
+    }
+    deep += char(0);
+    tmdesc::object_graph_storage deep_storage;
+    CHECK(!tmdesc::decode_graph(deep, decoded.root, deep_storage));
+}
+
+TEST_CASE("instrumented_encode_graph records the encoded size") {
+    using namespace object_graph_test;
+    const config c = make_config(3, make_subtree("defaults", 5), make_subtree("common", 2));
+    std::string out;
+    for (std::size_t i = 0; i < tmdesc::size_history<config>::merge_period; ++i) {
+        out.clear();
+        tmdesc::instrumented_encode_graph<tmdesc::size_tracking>(c, out);
+    }
+    CHECK(tmdesc::size_history<config>::expected() == out.size());
+}
+
+TEST_CASE("pointer_id_table") {
+    std::vector<int> objects(1000);
+    tmdesc::detail::pointer_id_table table;
+    for (std::size_t i = 0; i < objects.size(); ++i) {
+        const auto id = table.insert(&objects[i], tmdesc::type_id_v<int>);
+        CHECK(id.first == i);
+        CHECK(id.second);
+    }
+    for (std::size_t i = 0; i < objects.size(); i += 7) {
+        const auto id = table.insert(&objects[i], tmdesc::type_id_v<int>);
+        CHECK(id.first == i);
+        CHECK(!id.second);
+    }
+    CHECK(table.insert(&objects[0], tmdesc::type_id_v<unsigned>).first == objects.size());
+    CHECK(table.size() == objects.size() + 1);
+}
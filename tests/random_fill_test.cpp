@@ -0,0 +1,120 @@
+#include "test_helpers.hpp"
+#include <array>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <tmdesc/random_fill.hpp>
+#include <vector>
+
+namespace random_fill_test {
+enum class side { buy = 1, sell = 7 };
+template <class Impl> constexpr auto tmdesc_info(tmdesc::info_builder<side, Impl> b) {
+    return b.type(b.enumerators(b.enumerator("buy", side::buy), b.enumerator("sell", side::sell)));
+}
+
+enum class option : std::uint8_t { none = 0, hidden = 2, urgent = 16 };
+template <class Impl> constexpr auto tmdesc_info(tmdesc::info_builder<option, Impl> b) {
+    return b.type(b.attributes(b.flags()), b.enumerators(b.enumerator("none", option::none),
+                                                         b.enumerator("hidden", option::hidden),
+                                                         b.enumerator("urgent", option::urgent)));
+}
+
+struct opaque {
+    int value = 42;
+};
+
+struct fill_leg {
+    double price;
+    std::int8_t venue;
+    bool last;
+
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<fill_leg, Impl> b) {
+        return b.type(b.members(b.member("price", &fill_leg::price), b.member("venue", &fill_leg::venue),
+                                b.member("last", &fill_leg::last)));
+    }
+};
+
+struct order {
+    std::uint64_t id;
+    side direction;
+    option options;
+    std::string account;
+    std::vector<fill_leg> legs;
+    std::array<std::uint16_t, 3> tags;
+    opaque extra;
+
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<order, Impl> b) {
+        return b.type(b.members(b.member("id", &order::id), b.member("direction", &order::direction),
+                                b.member("options", &order::options), b.member("account", &order::account),
+                                b.member("legs", &order::legs), b.member("tags", &order::tags),
+                                b.member("extra", &order::extra)));
+    }
+};
+
+/// all strings have the same length
+struct fixed_size {
+    std::size_t size;
+    template <class Rng> std::size_t operator()(Rng&) const noexcept { return size; }
+};
+} // namespace random_fill_test
+
+TEST_CASE("random_fill") {
+    using namespace random_fill_test;
+    std::mt19937_64 rng(7);
+    tmdesc::random_fill_options options;
+    options.string_size    = {2, 5};
+    options.container_size = {1, 3};
+    options.alphabet       = "xy";
+    options.float_min      = 10.0;
+    options.float_max      = 20.0;
+
+    bool seen_buy = false, seen_sell = false, seen_urgent = false;
+    for (int i = 0; i < 100; ++i) {
+        order o{};
+        tmdesc::random_fill(o, rng, options);
+
+        CHECK((o.direction == side::buy || o.direction == side::sell));
+        seen_buy = seen_buy || o.direction == side::buy;
+        seen_sell = seen_sell || o.direction == side::sell;
+        CHECK((static_cast<int>(o.options) & ~(2 | 16)) == 0);
+        seen_urgent = seen_urgent || o.options == option::urgent;
+
+        CHECK(o.account.size() >= 2);
+        CHECK(o.account.size() <= 5);
+        CHECK(o.account.find_first_not_of("xy") == std::string::npos);
+
+        CHECK(o.legs.size() >= 1);
+        CHECK(o.legs.size() <= 3);
+        for (const fill_leg& leg : o.legs) {
+            CHECK(leg.price >= 10.0);
+            CHECK(leg.price < 20.0);
+        }
+        CHECK(o.extra.value == 42);
+    }
+    CHECK(seen_buy);
+    CHECK(seen_sell);
+    CHECK(seen_urgent);
+}
+
+TEST_CASE("random_fill is deterministic and accepts custom size distributions") {
+    using namespace random_fill_test;
+    tmdesc::basic_random_fill_options<fixed_size, fixed_size> options{{3}, {2}};
+
+    order first{}, second{};
+    std::mt19937 rng1(1), rng2(1);
+    tmdesc::random_fill(first, rng1, options);
+    tmdesc::random_fill(second, rng2, options);
+
+    CHECK(first.account.size() == 3);
+    CHECK(first.legs.size() == 2);
+    CHECK(first.id == second.id);
+    CHECK(first.account == second.account);
+    CHECK(first.tags == second.tags);
+    CHECK(first.legs[1].price == second.legs[1].price);
+    CHECK(first.legs[1].venue == second.legs[1].venue);
+
+    std::vector<int> values(4, 0);
+    std::minstd_rand small_rng(3);
+    tmdesc::random_fill(values, small_rng);
+    CHECK(values.size() <= 8);
+}
@@ -0,0 +1,115 @@
+#include "test_helpers.hpp"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <tmdesc/seqlock.hpp>
+#include <vector>
+
+namespace seqlock_test {
+enum class venue : std::uint8_t { lse, xetra };
+
+struct level {
+    double price;
+    std::int64_t size;
+
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<level, Impl> b) {
+        return b.type(b.members(b.member("price", &level::price), b.member("size", &level::size)));
+    }
+};
+
+struct book {
+    std::uint64_t sequence;
+    venue source;
+    level bids[2];
+    std::array<level, 2> asks;
+
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<book, Impl> b) {
+        return b.type(b.members(b.member("sequence", &book::sequence), b.member("source", &book::source),
+                                b.member("bids", &book::bids), b.member("asks", &book::asks)));
+    }
+};
+
+/// all fields are derived from the sequence, so a torn copy is detected
+book make_book(std::uint64_t i) {
+    book b{};
+    b.sequence = i;
+    b.source   = i % 2 ? venue::xetra : venue::lse;
+    for (std::size_t l = 0; l < 2; ++l) {
+        b.bids[l] = {double(i) - double(l), std::int64_t(i * 10 + l)};
+        b.asks[l] = {double(i) + double(l) + 1, std::int64_t(i * 20 + l)};
+    }
+    return b;
+}
+
+bool is_consistent(const book& b) {
+    const book expected = make_book(b.sequence);
+    bool result         = b.source == expected.source;
+    for (std::size_t l = 0; l < 2; ++l) {
+        result = result && b.bids[l].price == expected.bids[l].price && b.bids[l].size == expected.bids[l].size &&
+                 b.asks[l].price == expected.asks[l].price && b.asks[l].size == expected.asks[l].size;
+    }
+    return result;
+}
+} // namespace seqlock_test
+
+TEST_CASE("seqlock") {
+    using namespace seqlock_test;
+    tmdesc::seqlock<book> cache(make_book(3));
+    CHECK(cache.version() == 0);
+    CHECK(is_consistent(cache.load()));
+    CHECK(cache.load().sequence == 3);
+
+    cache.store(make_book(5));
+    CHECK(cache.version() == 1);
+    cache.modify([](book& b) { b.asks[1].size = 77; });
+    CHECK(cache.version() == 2);
+
+    book copy{};
+    CHECK(cache.try_load(copy));
+    CHECK(copy.sequence == 5);
+    CHECK(copy.asks[1].size == 77);
+    CHECK(copy.bids[1].price == 4.0);
+
+    bool thrown = false;
+    try {
+        cache.modify([](book& b) {
+            b.sequence = 100;
+            throw std::runtime_error("rejected");
+        });
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    CHECK(thrown);
+    CHECK(cache.version() == 3);
+    CHECK(cache.load().sequence == 5);
+}
+
+TEST_CASE("seqlock readers never see torn values") {
+    using namespace seqlock_test;
+    tmdesc::seqlock<book> cache(make_book(0));
+    std::atomic<bool> done{false};
+    std::atomic<int> torn{0};
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 3; ++r) {
+        readers.emplace_back([&] {
+            std::uint64_t last = 0;
+            while (!done.load()) {
+                const book b = cache.load();
+                if (!is_consistent(b) || b.sequence < last)
+                    ++torn;
+                last = b.sequence;
+            }
+        });
+    }
+    for (std::uint64_t i = 1; i <= 20000; ++i)
+        cache.store(make_book(i));
+    done = true;
+    for (auto& t : readers)
+        t.join();
+
+    CHECK(torn.load() == 0);
+    CHECK(cache.load().sequence == 20000);
+}
@@ -0,0 +1,65 @@
+#include "test_helpers.hpp"
+#include <string>
+#include <thread>
+#include <tmdesc/size_history.hpp>
+#include <vector>
+
+namespace size_history_test {
+struct message {};
+struct other_message {};
+struct reply {};
+} // namespace size_history_test
+
+TEST_CASE("size_history") {
+    using namespace size_history_test;
+    using history = tmdesc::size_history<message>;
+    CHECK(history::expected() == 0);
+
+    history::record(40);
+    CHECK(history::expected() == 40);
+    std::thread([] { CHECK(history::expected() == 0); }).join();
+
+    for (std::size_t i = 1; i < history::merge_period; ++i)
+        history::record(100);
+    CHECK(history::expected() == 100);
+    std::thread([] { CHECK(history::expected() == 100); }).join();
+
+    // the shared estimate decays by 1/8 per window of smaller sizes
+    for (std::size_t i = 0; i < history::merge_period; ++i)
+        history::record(10);
+    CHECK(history::expected() == 88);
+    CHECK(tmdesc::size_history<other_message>::expected() == 0);
+}
+
+TEST_CASE("reserve_expected") {
+    using namespace size_history_test;
+    std::string buffer = "head";
+    tmdesc::reserve_expected<reply>(buffer);
+    CHECK(buffer == "head");
+
+    for (std::size_t i = 0; i < tmdesc::size_history<reply>::merge_period; ++i) {
+        tmdesc::size_tracking::scope<reply> scope;
+        scope.add_bytes(200);
+        scope.add_bytes(56);
+    }
+    CHECK(tmdesc::size_history<reply>::expected() == 256);
+    tmdesc::reserve_expected<reply>(buffer);
+    CHECK(buffer.capacity() >= 260);
+
+    // the free capacity is enough: no reallocation
+    const std::size_t capacity = buffer.capacity();
+    tmdesc::reserve_expected<reply>(buffer);
+    CHECK(buffer.capacity() == capacity);
+
+    // appending the values reserves geometrically, not by the expected size each time:
+    // `vector::reserve` allocates exactly the requested capacity
+    std::vector<char> bytes;
+    std::size_t reallocations = 0;
+    for (int i = 0; i < 64; ++i) {
+        const std::size_t before = bytes.capacity();
+        tmdesc::reserve_expected<reply>(bytes);
+        bytes.insert(bytes.end(), 256, 'x');
+        reallocations += bytes.capacity() != before ? 1 : 0;
+    }
+    CHECK(reallocations <= 8);
+}
@@ -0,0 +1,78 @@
+#include "test_helpers.hpp"
+#include <memory>
+#include <string>
+#include <tmdesc/small_vector.hpp>
+#include <utility>
+
+STATIC_CHECK(tmdesc::small_vector<int, 4>::inline_capacity == 4);
+STATIC_CHECK(std::is_nothrow_move_constructible<tmdesc::small_vector<std::string, 2>>::value);
+STATIC_CHECK(tmdesc::detail::is_small_vector<tmdesc::small_vector<int, 1>>::value);
+
+TEST_CASE("small_vector stores small sequences inline") {
+    tmdesc::small_vector<int, 4> v;
+    CHECK(v.empty());
+    CHECK(v.capacity() == 4);
+    for (int i = 0; i < 4; ++i)
+        v.push_back(i);
+    CHECK(v.is_inline());
+    CHECK(v.size() == 4);
+    CHECK(v.back() == 3);
+
+    v.push_back(4);
+    CHECK(!v.is_inline());
+    CHECK(v.capacity() == 8);
+    for (int i = 0; i < 5; ++i)
+        CHECK(v[std::size_t(i)] == i);
+
+    v.resize(2);
+    CHECK(v.size() == 2);
+    v.resize(4, 7);
+    CHECK(v[3] == 7);
+    v.pop_back();
+    CHECK(v.size() == 3);
+    v.clear();
+    CHECK(v.empty());
+    CHECK(!v.is_inline());
+}
+
+TEST_CASE("small_vector copy and move") {
+    tmdesc::small_vector<std::string, 2> small{"a", "b"};
+    tmdesc::small_vector<std::string, 2> large{"a", "b", "c"};
+    CHECK(small.is_inline());
+    CHECK(!large.is_inline());
+
+    tmdesc::small_vector<std::string, 2> copy = large;
+    CHECK(copy == large);
+    copy = small;
+    CHECK(copy == small);
+    CHECK(copy != large);
+
+    const std::string* heap_data = large.data();
+    tmdesc::small_vector<std::string, 2> moved(std::move(large));
+    CHECK(moved.data() == heap_data);
+    CHECK(moved.size() == 3);
+    CHECK(large.empty());
+    CHECK(large.is_inline());
+
+    moved = std::move(small);
+    CHECK(moved.is_inline());
+    CHECK(moved.size() == 2);
+    CHECK(moved[1] == "b");
+}
+
+TEST_CASE("small_vector emplace_back of its own element") {
+    tmdesc::small_vector<std::string, 1> v{"long enough to allocate the string"};
+    v.emplace_back(v[0]);
+    CHECK(v.size() == 2);
+    CHECK(v[1] == v[0]);
+
+    v.resize(5, v[0]);
+    CHECK(v.size() == 5);
+    CHECK(v[4] == "long enough to allocate the string");
+
+    tmdesc::small_vector<std::unique_ptr<int>, 1> owners;
+    owners.emplace_back(new int(1));
+    owners.emplace_back(new int(2));
+    CHECK(*owners[0] == 1);
+    CHECK(*owners[1] == 2);
+}
@@ -0,0 +1,71 @@
+#include "test_helpers.hpp"
+#include <tmdesc/foldable_struct.hpp>
+#include <tmdesc/type_info/get_type_info.hpp>
+
+namespace type_info_test {
+struct note_tag {};
+
+struct point {
+    int x;
+    int y;
+
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<point, Impl> b) {
+        return b.type(b.attributes(b.type_name("point")),
+                      b.members(b.member("x", &point::x),
+                                b.member("y", &point::y,
+                                         b.attributes(tmdesc::attribute<note_tag, int>{42}, b.borrowed()))));
+    }
+};
+
+struct opaque {
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<opaque, Impl> b) {
+        return b.type(b.attributes(b.type_name("opaque")));
+    }
+};
+
+struct undescribed {};
+
+struct sum {
+    constexpr int operator()(int a, int b) const noexcept { return a + b; }
+};
+
+constexpr auto& members = tmdesc::static_type_members_v<point>.value();
+constexpr auto& y_attributes = tmdesc::at_c<1>(members).attributes();
+
+STATIC_CHECK(decltype(tmdesc::is_some(tmdesc::static_type_info_v<point>))::value);
+STATIC_CHECK(decltype(tmdesc::is_some(tmdesc::static_type_info_v<opaque>))::value);
+STATIC_CHECK(decltype(tmdesc::is_none(tmdesc::static_type_info_v<undescribed>))::value);
+
+STATIC_CHECK(decltype(tmdesc::is_none(tmdesc::static_type_members_v<opaque>))::value);
+STATIC_CHECK(decltype(tmdesc::is_none(tmdesc::static_type_members_v<undescribed>))::value);
+STATIC_CHECK(decltype(tmdesc::is_none(tmdesc::static_type_attributes_v<undescribed>))::value);
+
+STATIC_CHECK(tmdesc::size(members) == 2);
+STATIC_CHECK(tmdesc::at_c<0>(members).name() == "x");
+STATIC_CHECK(tmdesc::at_c<1>(members).name() == "y");
+STATIC_CHECK(tmdesc::at_c<1>(members).getter()(point{1, 2}) == 2);
+
+STATIC_CHECK(tmdesc::has_key_v<decltype(y_attributes), note_tag>);
+STATIC_CHECK(tmdesc::has_key_v<decltype(y_attributes), tmdesc::tags::borrowed>);
+STATIC_CHECK(!tmdesc::has_key_v<decltype(y_attributes), tmdesc::tags::type_name>);
+STATIC_CHECK(tmdesc::at_key(y_attributes, tmdesc::type_c<note_tag>) == 42);
+STATIC_CHECK(!tmdesc::has_key_v<decltype(tmdesc::at_c<0>(members).attributes()), note_tag>);
+
+STATIC_CHECK(tmdesc::at_key(tmdesc::static_type_attributes_v<point>.value(), tmdesc::type_c<tmdesc::tags::type_name>) ==
+             "point");
+STATIC_CHECK(tmdesc::at_key(tmdesc::static_type_attributes_v<opaque>.value(), tmdesc::type_c<tmdesc::tags::type_name>) ==
+             "opaque");
+
+STATIC_CHECK(tmdesc::unpack(point{3, 4}, sum{}) == 7);
+} // namespace type_info_test
+
+TEST_CASE("described struct is foldable") {
+    using namespace type_info_test;
+    point p{1, 2};
+    tmdesc::unpack(p, [](int& x, int& y) {
+        x += 10;
+        y += 20;
+    });
+    CHECK(p.x == 11);
+    CHECK(p.y == 22);
+}
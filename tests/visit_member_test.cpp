@@ -0,0 +1,79 @@
+#include "test_helpers.hpp"
+#include <string>
+#include <tmdesc/visit_member.hpp>
+
+namespace visit_member_test {
+struct config {
+    int threads;
+    double ratio;
+    std::string title;
+
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<config, Impl> b) {
+        return b.type(b.members(b.member("threads", &config::threads), //
+                                b.member("ratio", &config::ratio),     //
+                                b.member("title", &config::title)));
+    }
+};
+
+struct empty {
+    template <class Impl> friend constexpr auto tmdesc_info(tmdesc::info_builder<empty, Impl> b) {
+        return b.type(b.members());
+    }
+};
+
+struct set_number {
+    double value;
+    void operator()(int& v) const { v = int(value); }
+    void operator()(double& v) const { v = value; }
+    void operator()(std::string&) const {}
+};
+
+struct to_string {
+    std::string& out;
+    void operator()(const int& v) const { out = std::to_string(v); }
+    void operator()(const double& v) const { out = std::to_string(v); }
+    void operator()(const std::string& v) const { out = v; }
+};
+
+static_assert(tmdesc::find_member_index<config>("threads") == 0, "");
+static_assert(tmdesc::find_member_index<config>("ratio") == 1, "");
+static_assert(tmdesc::find_member_index<config>("title") == 2, "");
+static_assert(tmdesc::find_member_index<config>("titles") == tmdesc::string_view::npos, "");
+static_assert(tmdesc::find_member_index<config>("") == tmdesc::string_view::npos, "");
+static_assert(tmdesc::find_member_index<empty>("x") == tmdesc::string_view::npos, "");
+} // namespace visit_member_test
+
+TEST_CASE("perfect_hash") {
+    static constexpr const char* keys[] = {"id",   "name", "a",    "b",    "c",     "d",     "e",     "f",
+                                           "g",    "h",    "ab",   "ba",   "abc",   "cba",   "bca",   "x0",
+                                           "x1",   "x2",   "x3",   "x4",   "x5",    "x6",    "x7",    "x8",
+                                           "x9",   "x10",  "x11",  "x12",  "x13",   "x14",   "x15",   "q"};
+    static constexpr tmdesc::perfect_hash<32> index{keys};
+    static_assert(index.find("q") == 31, "");
+    for (std::size_t i = 0; i < 32; ++i) {
+        CHECK(index.find(keys[i]) == i);
+    }
+    CHECK(index.find("x16") == tmdesc::string_view::npos);
+    CHECK(index.find("") == tmdesc::string_view::npos);
+}
+
+TEST_CASE("visit_member_by_name") {
+    using namespace visit_member_test;
+    config c{1, 0.5, "default"};
+
+    CHECK(tmdesc::visit_member_by_name(c, "threads", set_number{8}));
+    CHECK(tmdesc::visit_member_by_name(c, "ratio", set_number{0.25}));
+    CHECK(!tmdesc::visit_member_by_name(c, "unknown", set_number{3}));
+    CHECK(c.threads == 8);
+    CHECK(c.ratio == 0.25);
+
+    std::string out;
+    const config& cc = c;
+    CHECK(tmdesc::visit_member_by_name(cc, "title", to_string{out}));
+    CHECK(out == "default");
+    CHECK(tmdesc::visit_member_by_name(cc, "threads", to_string{out}));
+    CHECK(out == "8");
+
+    empty e;
+    CHECK(!tmdesc::visit_member_by_name(e, "threads", to_string{out}));
+}